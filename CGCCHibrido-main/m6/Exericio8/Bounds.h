@@ -0,0 +1,79 @@
+#pragma once
+
+#include <algorithm>
+
+//GLM
+#include <glm/glm.hpp>
+
+// Caixa alinhada aos eixos. Vazia (min > max) at receber o primeiro ponto.
+struct AABB
+{
+	glm::vec3 min = glm::vec3(1e30f);
+	glm::vec3 max = glm::vec3(-1e30f);
+
+	bool empty() const { return min.x > max.x; }
+	glm::vec3 center() const { return (min + max) * 0.5f; }
+	glm::vec3 extents() const { return (max - min) * 0.5f; }
+
+	void expand(const glm::vec3& point)
+	{
+		min = glm::min(min, point);
+		max = glm::max(max, point);
+	}
+
+	// rea da superfcie (custo da heurstica SAH)
+	float surfaceArea() const
+	{
+		glm::vec3 d = max - min;
+		return 2.0f * (d.x * d.y + d.y * d.z + d.z * d.x);
+	}
+
+	bool contains(const AABB& other) const
+	{
+		return min.x <= other.min.x && min.y <= other.min.y && min.z <= other.min.z
+			&& other.max.x <= max.x && other.max.y <= max.y && other.max.z <= max.z;
+	}
+
+	bool overlaps(const AABB& other) const
+	{
+		return min.x <= other.max.x && other.min.x <= max.x && min.y <= other.max.y && other.min.y <= max.y
+			&& min.z <= other.max.z && other.min.z <= max.z;
+	}
+
+	static AABB merge(const AABB& a, const AABB& b)
+	{
+		AABB result;
+		result.min = glm::min(a.min, b.min);
+		result.max = glm::max(a.max, b.max);
+		return result;
+	}
+
+	// Caixa que contm esta depois de transformada: o centro  transformado e as
+	// meia-extenses projetadas nos eixos pelo valor absoluto da rotao/escala
+	AABB transformed(const glm::mat4& m) const
+	{
+		glm::vec3 c = glm::vec3(m * glm::vec4(center(), 1.0f));
+		glm::vec3 e = extents();
+		glm::vec3 world = glm::abs(glm::vec3(m[0])) * e.x + glm::abs(glm::vec3(m[1])) * e.y + glm::abs(glm::vec3(m[2])) * e.z;
+		AABB result;
+		result.min = c - world;
+		result.max = c + world;
+		return result;
+	}
+};
+
+struct BoundingSphere
+{
+	glm::vec3 center = glm::vec3(0.0f);
+	float radius = 0.0f;
+
+	// O raio cresce pela maior escala da matriz (vale para escala no uniforme)
+	BoundingSphere transformed(const glm::mat4& m) const
+	{
+		float scale = std::max(glm::length(glm::vec3(m[0])), std::max(glm::length(glm::vec3(m[1])), glm::length(glm::vec3(m[2]))));
+		BoundingSphere result;
+		result.center = glm::vec3(m * glm::vec4(center, 1.0f));
+		result.radius = radius * scale;
+		return result;
+	}
+};
@@ -48,6 +48,15 @@ public:
         updateCameraVectors();
     }
 
+    // Posiciona e orienta a cmera de uma vez (ex.: caminho gravado)
+    void SetPose(glm::vec3 position, float yaw, float pitch)
+    {
+        Position = position;
+        Yaw = yaw;
+        Pitch = pitch;
+        updateCameraVectors();
+    }
+
     // Retorna a matriz de visualizao calculada usando os ngulos Euler
     glm::mat4 GetViewMatrix()
     {
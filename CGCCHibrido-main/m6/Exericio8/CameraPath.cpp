@@ -0,0 +1,107 @@
+#include "CameraPath.h"
+
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <algorithm>
+
+//GLFW
+#include <GLFW/glfw3.h>
+
+template<typename T>
+static T catmullRom(const T& p0, const T& p1, const T& p2, const T& p3, float t)
+{
+	float t2 = t * t, t3 = t2 * t;
+	return 0.5f * ((2.0f * p1) + (p2 - p0) * t + (2.0f * p0 - 5.0f * p1 + 4.0f * p2 - p3) * t2 + (3.0f * p1 - p0 - 3.0f * p2 + p3) * t3);
+}
+
+bool CameraPath::load(const std::string& path)
+{
+	std::ifstream inputFile(path.c_str());
+	if (!inputFile.is_open())
+	{
+		std::cout << "Problema ao encontrar o arquivo " << path << std::endl;
+		return false;
+	}
+
+	points.clear();
+	keyEvents.clear();
+	std::string line;
+	int lineNumber = 0;
+	while (std::getline(inputFile, line))
+	{
+		lineNumber++;
+		line = line.substr(0, line.find('#'));
+		std::istringstream ssline(line);
+		std::string word;
+		if (!(ssline >> word))
+			continue;
+
+		bool ok = false;
+		if (word == "camera")
+		{
+			ControlPoint point;
+			ok = (bool)(ssline >> point.time >> point.position.x >> point.position.y >> point.position.z >> point.yaw >> point.pitch);
+			if (ok && !points.empty() && point.time <= points.back().time)
+				ok = false;
+			if (ok)
+				points.push_back(point);
+		}
+		else if (word == "key")
+		{
+			KeyEvent event;
+			std::string key, action;
+			ok = (bool)(ssline >> event.time >> key >> action) && key.size() == 1 && (action == "press" || action == "release");
+			if (ok)
+			{
+				char c = (char)toupper(key[0]);
+				ok = (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9');
+				event.key = c; //GLFW_KEY_A.. e GLFW_KEY_0.. so os prprios cdigos ASCII
+				event.action = action == "press" ? GLFW_PRESS : GLFW_RELEASE;
+			}
+			if (ok)
+				keyEvents.push_back(event);
+		}
+		if (!ok)
+		{
+			std::cout << path << ":" << lineNumber << ": linha invalida (" << line << ")" << std::endl;
+			return false;
+		}
+	}
+	if (points.empty())
+	{
+		std::cout << path << ": nenhum ponto de camera" << std::endl;
+		return false;
+	}
+	std::stable_sort(keyEvents.begin(), keyEvents.end(), [](const KeyEvent& a, const KeyEvent& b) { return a.time < b.time; });
+	return true;
+}
+
+void CameraPath::sample(float time, Camera& camera) const
+{
+	if (points.empty())
+		return;
+	time = std::min(std::max(time, points.front().time), points.back().time);
+
+	// Trecho [i, i + 1] que contm 'time'; as pontas repetem o primeiro e o ltimo ponto
+	int i = 0;
+	while (i + 2 < (int)points.size() && points[i + 1].time <= time)
+		i++;
+	int last = (int)points.size() - 1;
+	const ControlPoint& p0 = points[std::max(i - 1, 0)];
+	const ControlPoint& p1 = points[i];
+	const ControlPoint& p2 = points[std::min(i + 1, last)];
+	const ControlPoint& p3 = points[std::min(i + 2, last)];
+	float t = p2.time > p1.time ? (time - p1.time) / (p2.time - p1.time) : 0.0f;
+
+	camera.SetPose(catmullRom(p0.position, p1.position, p2.position, p3.position, t),
+		catmullRom(p0.yaw, p1.yaw, p2.yaw, p3.yaw, t), catmullRom(p0.pitch, p1.pitch, p2.pitch, p3.pitch, t));
+}
+
+void CameraPath::eventsBetween(float from, float to, std::vector<KeyEvent>& events) const
+{
+	events.clear();
+	for (const KeyEvent& event : keyEvents)
+		if (event.time >= from && event.time < to)
+			events.push_back(event);
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+//GLM
+#include <glm/glm.hpp>
+
+#include "Camera.h"
+
+// Caminho gravado de cmera, com os eventos de teclado, para o --benchmark.
+// Arquivo de texto, uma linha por ponto de controle ou evento (tempo em
+// segundos, crescente; '#' comea um comentrio):
+//   camera <tempo> <x> <y> <z> <yaw> <pitch>
+//   key <tempo> <tecla> press|release
+// A tecla  uma letra ou um dgito (a mesma do teclado). Entre os pontos a
+// cmera segue uma Catmull-Rom que passa por todos eles, ento o caminho 
+// suave e sempre o mesmo, qualquer que seja a taxa de quadros.
+class CameraPath
+{
+public:
+	struct KeyEvent
+	{
+		float time;
+		int key; //GLFW_KEY_*
+		int action; //GLFW_PRESS ou GLFW_RELEASE
+	};
+
+	bool load(const std::string& path);
+
+	// Pe a cmera no ponto do caminho no instante 'time' (limitado ao intervalo gravado)
+	void sample(float time, Camera& camera) const;
+	// Eventos com tempo em [from, to)
+	void eventsBetween(float from, float to, std::vector<KeyEvent>& events) const;
+	float duration() const { return points.empty() ? 0.0f : points.back().time; }
+
+protected:
+	struct ControlPoint
+	{
+		float time;
+		glm::vec3 position;
+		float yaw, pitch;
+	};
+
+	std::vector<ControlPoint> points;
+	std::vector<KeyEvent> keyEvents;
+};
@@ -0,0 +1,252 @@
+#include "CascadedShadows.h"
+
+#include <iostream>
+#include <string>
+#include <cmath>
+#include <algorithm>
+
+//GLM
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include "GLDevice.h"
+#include "GLState.h"
+#include "Profiler.h"
+
+// Quanto antes da esfera da cascata (na direo da luz) ainda entra como oclusor
+static const float CASTER_MARGIN = 20.0f;
+// Peso da diviso logartmica na mistura com a uniforme
+static const float SPLIT_LAMBDA = 0.75f;
+// Desvio do ponto pela normal antes de consultar o mapa, em texels da cascata
+static const float NORMAL_OFFSET_TEXELS = 1.5f;
+
+CascadedShadows::CascadedShadows() : resolution(0), pageResolution(0), lightDirection(0.0f, -1.0f, 0.0f), fovY(glm::radians(45.0f)), aspect(1.0f),
+	nearPlane(0.1f), shadowDistance(20.0f), staticValid(false), liveTexture(0), staticTexture(0)
+{
+	for (int c = 0; c < CASCADES; c++)
+	{
+		splits[c] = 0.0f;
+		texelWorld[c] = 0.0f;
+		lightViewProjection[c] = pageViewProjection[c] = glm::mat4(1.0f);
+		cascadeOrigin[c][0] = cascadeOrigin[c][1] = pageOrigin[c][0] = pageOrigin[c][1] = 0;
+		pageDepth[c][0] = pageDepth[c][1] = 0.0f;
+		pageTexel[c] = 0.0f;
+		pageDirty[c] = true;
+		liveFramebuffers[c] = staticFramebuffers[c] = 0;
+	}
+}
+
+// Folga da pgina em texels de cada lado
+static int pageMargin(int resolution)
+{
+	return (int)(resolution * CascadedShadows::PAGE_MARGIN);
+}
+
+CascadedShadows::~CascadedShadows()
+{
+	release();
+}
+
+bool CascadedShadows::init(int resolution)
+{
+	release();
+	this->resolution = resolution;
+	pageResolution = resolution + 2 * pageMargin(resolution);
+	liveTexture = glDevice.createTexture2DArray(GL_DEPTH_COMPONENT32F, resolution, resolution, CASCADES);
+	// Mesmo formato do mapa do quadro, para a cpia de profundidade valer
+	staticTexture = glDevice.createTexture2DArray(GL_DEPTH_COMPONENT32F, pageResolution, pageResolution, CASCADES);
+	// O mapa usado no shader compara na amostragem, e o filtro linear junta 4 comparaes (PCF de hardware)
+	glDevice.textureParameter(liveTexture, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE, GL_TEXTURE_2D_ARRAY);
+	glDevice.textureParameter(liveTexture, GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL, GL_TEXTURE_2D_ARRAY);
+	glDevice.textureParameter(liveTexture, GL_TEXTURE_MIN_FILTER, GL_LINEAR, GL_TEXTURE_2D_ARRAY);
+	glDevice.textureParameter(liveTexture, GL_TEXTURE_MAG_FILTER, GL_LINEAR, GL_TEXTURE_2D_ARRAY);
+	glDevice.textureParameter(liveTexture, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE, GL_TEXTURE_2D_ARRAY);
+	glDevice.textureParameter(liveTexture, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE, GL_TEXTURE_2D_ARRAY);
+
+	for (int c = 0; c < CASCADES; c++)
+	{
+		liveFramebuffers[c] = glDevice.createFramebuffer({}, liveTexture, GL_DEPTH_ATTACHMENT, c);
+		staticFramebuffers[c] = glDevice.createFramebuffer({}, staticTexture, GL_DEPTH_ATTACHMENT, c);
+		if (liveFramebuffers[c] == 0 || staticFramebuffers[c] == 0)
+		{
+			std::cout << "CascadedShadows: framebuffer incompleto, sem sombras" << std::endl;
+			release();
+			return false;
+		}
+	}
+	staticValid = false;
+	for (int c = 0; c < CASCADES; c++)
+		pageTexel[c] = 0.0f;
+	stats = ShadowStats();
+	return true;
+}
+
+void CascadedShadows::release()
+{
+	for (int c = 0; c < CASCADES; c++)
+	{
+		for (GLuint* framebuffer : { &liveFramebuffers[c], &staticFramebuffers[c] })
+		{
+			if (*framebuffer != 0)
+				glState.deleteFramebuffer(*framebuffer);
+			*framebuffer = 0;
+		}
+	}
+	for (GLuint* texture : { &liveTexture, &staticTexture })
+	{
+		if (*texture != 0)
+			glState.deleteTexture(*texture);
+		*texture = 0;
+	}
+}
+
+void CascadedShadows::setLightDirection(const glm::vec3& direction)
+{
+	lightDirection = glm::normalize(direction);
+	// O espao da luz girou: nenhuma pgina serve mais
+	staticValid = false;
+	for (int c = 0; c < CASCADES; c++)
+		pageTexel[c] = 0.0f;
+}
+
+void CascadedShadows::setProjection(float fovY, float aspect, float nearPlane, float shadowDistance)
+{
+	this->fovY = fovY;
+	this->aspect = aspect;
+	this->nearPlane = nearPlane;
+	this->shadowDistance = shadowDistance;
+}
+
+void CascadedShadows::update(const glm::mat4& view)
+{
+	glm::mat4 inverseView = glm::inverse(view);
+	// Rotao da luz (a posio entra na projeo de cada cascata)
+	glm::vec3 up = std::abs(lightDirection.y) > 0.99f ? glm::vec3(0.0f, 0.0f, 1.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
+	glm::mat4 lightView = glm::lookAt(glm::vec3(0.0f), lightDirection, up);
+	// As pginas andam em passos de meia folga, ento uma pgina nova deixa a cascata
+	// entre uma e uma folga e meia da borda de baixo e pelo menos meia folga da de cima
+	int margin = pageMargin(resolution);
+	int step = std::max(1, margin / 2);
+
+	// Um canto da fatia na profundidade d fica a d * k do eixo da cmera
+	float tanHalfY = std::tan(fovY * 0.5f);
+	float k2 = tanHalfY * tanHalfY * (1.0f + aspect * aspect);
+	float sliceNear = nearPlane;
+	for (int c = 0; c < CASCADES; c++)
+	{
+		float t = (float)(c + 1) / CASCADES;
+		float logarithmic = nearPlane * std::pow(shadowDistance / nearPlane, t);
+		float uniform = nearPlane + (shadowDistance - nearPlane) * t;
+		float sliceFar = uniform + (logarithmic - uniform) * SPLIT_LAMBDA;
+		splits[c] = sliceFar;
+
+		// Menor esfera com os 8 cantos da fatia: centro no eixo, equidistante dos cantos
+		// de perto e de longe. S depende da fatia, no da orientao da cmera.
+		float centerDepth = std::min((sliceNear + sliceFar) * (1.0f + k2) * 0.5f, sliceFar);
+		float radius = std::sqrt((sliceFar - centerDepth) * (sliceFar - centerDepth) + sliceFar * sliceFar * k2);
+		radius = std::ceil(radius * 16.0f) / 16.0f;
+		texelWorld[c] = 2.0f * radius / resolution;
+
+		// Canto da cascata no espao da luz, arredondado para um texel inteiro
+		float texel = texelWorld[c];
+		glm::vec3 center = glm::vec3(lightView * inverseView * glm::vec4(0.0f, 0.0f, -centerDepth, 1.0f));
+		int x = (int)std::floor(center.x / texel) - resolution / 2;
+		int y = (int)std::floor(center.y / texel) - resolution / 2;
+		cascadeOrigin[c][0] = x;
+		cascadeOrigin[c][1] = y;
+		// Profundidades (ao longo da luz) que a esfera e os oclusores antes dela pedem
+		float nearDepth = -center.z - radius - CASTER_MARGIN;
+		float farDepth = -center.z + radius;
+
+		bool inside = pageTexel[c] == texel
+			&& x >= pageOrigin[c][0] && x + resolution <= pageOrigin[c][0] + pageResolution
+			&& y >= pageOrigin[c][1] && y + resolution <= pageOrigin[c][1] + pageResolution
+			&& nearDepth >= pageDepth[c][0] && farDepth <= pageDepth[c][1];
+		if (!inside)
+		{
+			// Pgina nova na grade fixa de 'step' texels (e de profundidade), com a folga em volta da cascata
+			pageOrigin[c][0] = (int)std::floor((float)(x - margin) / step) * step;
+			pageOrigin[c][1] = (int)std::floor((float)(y - margin) / step) * step;
+			float depthStep = step * texel;
+			float depthMargin = margin * texel;
+			pageDepth[c][0] = std::floor((nearDepth - depthMargin) / depthStep) * depthStep;
+			pageDepth[c][1] = pageDepth[c][0] + std::ceil((farDepth - nearDepth + 2.0f * depthMargin) / depthStep) * depthStep;
+			pageTexel[c] = texel;
+			glm::mat4 pageProjection = glm::ortho(pageOrigin[c][0] * texel, (pageOrigin[c][0] + pageResolution) * texel,
+				pageOrigin[c][1] * texel, (pageOrigin[c][1] + pageResolution) * texel, pageDepth[c][0], pageDepth[c][1]);
+			pageViewProjection[c] = pageProjection * lightView;
+			pageDirty[c] = true;
+		}
+
+		// A cascata usa a faixa de profundidade da pgina: o que foi gravado nela vale igual aqui
+		glm::mat4 projection = glm::ortho(x * texel, (x + resolution) * texel, y * texel, (y + resolution) * texel,
+			pageDepth[c][0], pageDepth[c][1]);
+		lightViewProjection[c] = projection * lightView;
+		sliceNear = sliceFar;
+	}
+}
+
+void CascadedShadows::render(Shader* depthShader, const DrawCasters& drawCasters)
+{
+	PROFILE_ZONE("CascadedShadows::render");
+	if (!ready() || !depthShader)
+		return;
+	int x, y, width, height;
+	glState.getViewport(x, y, width, height);
+	glState.enable(GL_DEPTH_TEST, true);
+	glState.depthMask(true);
+	// Inclinao + constante: tira a acne das superfcies quase paralelas  luz
+	glState.enable(GL_POLYGON_OFFSET_FILL, true);
+	glPolygonOffset(2.0f, 4.0f);
+	depthShader->Use();
+
+	stats.frames++;
+	for (int c = 0; c < CASCADES; c++)
+	{
+		const glm::mat4& matrix = lightViewProjection[c];
+		if (!staticValid || pageDirty[c])
+		{
+			glState.viewport(0, 0, pageResolution, pageResolution);
+			glState.bindFramebuffer(GL_FRAMEBUFFER, staticFramebuffers[c]);
+			glClear(GL_DEPTH_BUFFER_BIT);
+			depthShader->setMat4("lightViewProjection", glm::value_ptr(pageViewProjection[c]));
+			drawCasters(depthShader, true, pageViewProjection[c]);
+			pageDirty[c] = false;
+			stats.staticRedraws++;
+		}
+		else
+			stats.staticReuses++;
+
+		// Pedao da pgina sob a cascata -> mapa do quadro, e os dinmicos por cima
+		int offsetX = cascadeOrigin[c][0] - pageOrigin[c][0];
+		int offsetY = cascadeOrigin[c][1] - pageOrigin[c][1];
+		glState.viewport(0, 0, resolution, resolution);
+		glState.bindFramebuffer(GL_READ_FRAMEBUFFER, staticFramebuffers[c]);
+		glState.bindFramebuffer(GL_DRAW_FRAMEBUFFER, liveFramebuffers[c]);
+		glBlitFramebuffer(offsetX, offsetY, offsetX + resolution, offsetY + resolution, 0, 0, resolution, resolution, GL_DEPTH_BUFFER_BIT, GL_NEAREST);
+		glState.bindFramebuffer(GL_READ_FRAMEBUFFER, liveFramebuffers[c]);
+		depthShader->setMat4("lightViewProjection", glm::value_ptr(matrix));
+		drawCasters(depthShader, false, matrix);
+	}
+	staticValid = true;
+
+	glState.enable(GL_POLYGON_OFFSET_FILL, false);
+	glState.bindFramebuffer(GL_FRAMEBUFFER, glState.screenFramebuffer());
+	glState.viewport(x, y, width, height);
+}
+
+void CascadedShadows::apply(Shader* shader) const
+{
+	// (u, v, profundidade) em [0, 1] em vez de [-1, 1]
+	const glm::mat4 bias = glm::translate(glm::mat4(1.0f), glm::vec3(0.5f)) * glm::scale(glm::mat4(1.0f), glm::vec3(0.5f));
+	glState.bindTexture(TEXTURE_UNIT, GL_TEXTURE_2D_ARRAY, liveTexture);
+	shader->setInt("shadowMap", TEXTURE_UNIT);
+	shader->setVec3("lightDirection", lightDirection.x, lightDirection.y, lightDirection.z);
+	for (int c = 0; c < CASCADES; c++)
+	{
+		glm::mat4 matrix = bias * lightViewProjection[c];
+		shader->setMat4("shadowMatrices[" + std::to_string(c) + "]", glm::value_ptr(matrix));
+	}
+	shader->setVec4("shadowSplits", splits[0], splits[1], splits[2], NORMAL_OFFSET_TEXELS);
+	shader->setVec4("shadowTexels", texelWorld[0], texelWorld[1], texelWorld[2], 1.0f / resolution);
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <functional>
+
+//GLAD
+#include <glad/glad.h>
+
+//GLM
+#include <glm/glm.hpp>
+
+#include "Shader.h"
+
+// Contadores do CascadedShadows desde o init()
+struct ShadowStats
+{
+	int frames = 0;
+	int staticRedraws = 0; //Pginas estticas redesenhadas (cascata saiu da pgina ou invalidateStatic())
+	int staticReuses = 0; //Pginas estticas s copiadas
+};
+
+// Sombras da luz direcional em cascatas. O trecho do frustum da cmera at
+// shadowDistance  dividido em CASCADES fatias (mistura das divises uniforme
+// e logartmica), e cada fatia ganha um mapa de sombra ortogrfico numa camada
+// de um array de texturas de profundidade (sampler2DArrayShadow no shader,
+// shaders/include/shadows.glsl, com PCF de 3x3).
+//
+// Cascatas estveis: cada uma cobre a esfera que envolve a sua fatia, ento o
+// tamanho no muda quando a cmera gira, e a origem  arredondada para um texel
+// inteiro, ento as bordas da sombra no tremem quando a cmera anda.
+//
+// Pginas em cache: a geometria esttica  desenhada num segundo array (as
+// pginas estticas), em que cada cascata tem uma janela do espao da luz maior
+// que ela (PAGE_MARGIN a mais de cada lado, na mesma densidade de texels) presa
+// a uma grade fixa, que no depende da cmera. A faixa de profundidade da
+// cascata  a da pgina (tambm presa  grade), ento a profundidade gravada
+// na pgina vale igual no mapa do quadro. A cada quadro o pedao da pgina sob
+// a cascata  copiado com o deslocamento em texels para o mapa usado no shader
+// (glBlitFramebuffer) e s os objetos dinmicos so desenhados por cima; a
+// pgina s  redesenhada quando a cascata sai dela.
+class CascadedShadows
+{
+public:
+	static const int CASCADES = 3;
+	// Unidade de textura do mapa no passo de luz
+	static const int TEXTURE_UNIT = 7;
+	// Folga da pgina esttica em cada lado, em fraes da resoluo da cascata
+	static constexpr float PAGE_MARGIN = 0.25f;
+
+	// Desenha os objetos que projetam sombra com 'shader' (uniforms model e lightViewProjection).
+	// 'staticCasters' escolhe os estticos (pgina em cache) ou os dinmicos (todo quadro);
+	// 'lightViewProjection' serve para descartar os que esto fora da cascata.
+	typedef std::function<void(Shader* shader, bool staticCasters, const glm::mat4& lightViewProjection)> DrawCasters;
+
+	CascadedShadows();
+	~CascadedShadows();
+
+	// Cria os arrays de profundidade (resolution x resolution por cascata, e as pginas estticas
+	// com a folga); false se o framebuffer ficar incompleto
+	bool init(int resolution = 2048);
+	void release();
+	bool ready() const { return liveTexture != 0; }
+
+	// Direo em que a luz viaja (ex.: -lightPos para uma luz "no alto")
+	void setLightDirection(const glm::vec3& direction);
+	// Projeo da cmera e at onde h sombra
+	void setProjection(float fovY, float aspect, float nearPlane, float shadowDistance);
+	// Fora redesenhar as pginas estticas (a geometria esttica mudou)
+	void invalidateStatic() { staticValid = false; }
+
+	// Calcula as cascatas para a cmera do quadro e move as pginas de que elas saram
+	void update(const glm::mat4& view);
+	// Monta os mapas: pginas estticas que mudaram, cpia e os dinmicos por cima
+	void render(Shader* depthShader, const DrawCasters& drawCasters);
+	// Liga o mapa e manda os uniforms da variante SHADOWS (inclusive a direo da luz usada no Phong)
+	void apply(Shader* shader) const;
+
+	const glm::vec3& getLightDirection() const { return lightDirection; }
+	const glm::mat4& cascadeMatrix(int cascade) const { return lightViewProjection[cascade]; }
+	float cascadeEnd(int cascade) const { return splits[cascade]; }
+	const ShadowStats& totalStats() const { return stats; }
+
+protected:
+	int resolution, pageResolution;
+	glm::vec3 lightDirection;
+	float fovY, aspect, nearPlane, shadowDistance;
+	float splits[CASCADES]; //Fim de cada cascata (profundidade na cmera)
+	float texelWorld[CASCADES]; //Tamanho de um texel no mundo
+	glm::mat4 lightViewProjection[CASCADES];
+	// Posies no espao da luz em texels da cascata (x, y do canto inferior esquerdo)
+	int cascadeOrigin[CASCADES][2];
+	int pageOrigin[CASCADES][2];
+	float pageDepth[CASCADES][2]; //Near e far da pgina (e da cascata) no espao da luz
+	float pageTexel[CASCADES]; //texelWorld com que a pgina foi posta
+	glm::mat4 pageViewProjection[CASCADES];
+	bool pageDirty[CASCADES]; //Pgina movida, falta redesenhar
+	bool staticValid;
+
+	GLuint liveTexture, staticTexture;
+	GLuint liveFramebuffers[CASCADES], staticFramebuffers[CASCADES];
+	ShadowStats stats;
+};
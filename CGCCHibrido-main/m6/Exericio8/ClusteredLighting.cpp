@@ -0,0 +1,296 @@
+#include "ClusteredLighting.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#include "GLDevice.h"
+#include "GLState.h"
+#include "JobSystem.h"
+#include "Profiler.h"
+
+// AVX quando o compilador gera AVX (/arch:AVX2 ou -mavx2)
+#if defined(__AVX__)
+#include <immintrin.h>
+#define CG_CLUSTER_AVX 1
+#endif
+
+ClusteredLighting::ClusteredLighting() : nearPlane(0.1f), farPlane(100.0f), sliceScale(1.0f), tanHalfX(1.0f), tanHalfY(1.0f),
+	screenWidth(1), screenHeight(1), lightBuffer(0), gridBuffer(0), indexBuffer(0), lightTexture(0), gridTexture(0), indexTexture(0)
+{
+	clusterItems.resize((size_t)CLUSTER_COUNT * MAX_LIGHTS_PER_CLUSTER);
+	clusterCounts.assign(CLUSTER_COUNT, 0);
+	sliceOverflows.assign(GRID_Z, 0);
+	grid.assign(CLUSTER_COUNT * 2, 0);
+}
+
+ClusteredLighting::~ClusteredLighting()
+{
+	release();
+}
+
+const char* ClusteredLighting::simdName()
+{
+#if defined(CG_CLUSTER_AVX)
+	return "AVX";
+#else
+	return "escalar";
+#endif
+}
+
+void ClusteredLighting::init()
+{
+	release();
+	lightBuffer = glDevice.createBuffer(MAX_LIGHTS * sizeof(GpuLight), NULL, GL_DYNAMIC_STORAGE_BIT);
+	gridBuffer = glDevice.createBuffer(CLUSTER_COUNT * 2 * sizeof(uint32_t), NULL, GL_DYNAMIC_STORAGE_BIT);
+	indexBuffer = glDevice.createBuffer((GLsizeiptr)CLUSTER_COUNT * MAX_LIGHTS_PER_CLUSTER * sizeof(uint16_t), NULL, GL_DYNAMIC_STORAGE_BIT);
+	lightTexture = glDevice.createBufferTexture(GL_RGBA32F, lightBuffer);
+	gridTexture = glDevice.createBufferTexture(GL_RG32UI, gridBuffer);
+	indexTexture = glDevice.createBufferTexture(GL_R16UI, indexBuffer);
+}
+
+void ClusteredLighting::release()
+{
+	for (GLuint* texture : { &lightTexture, &gridTexture, &indexTexture })
+	{
+		if (*texture != 0)
+			glState.deleteTexture(*texture);
+		*texture = 0;
+	}
+	for (GLuint* buffer : { &lightBuffer, &gridBuffer, &indexBuffer })
+	{
+		if (*buffer != 0)
+			glState.deleteBuffer(*buffer);
+		*buffer = 0;
+	}
+}
+
+void ClusteredLighting::setProjection(float fovY, float aspect, float nearPlane, float farPlane, int screenWidth, int screenHeight)
+{
+	this->nearPlane = nearPlane;
+	this->farPlane = farPlane;
+	this->screenWidth = screenWidth;
+	this->screenHeight = screenHeight;
+	sliceScale = GRID_Z / std::log(farPlane / nearPlane);
+	tanHalfY = std::tan(fovY * 0.5f);
+	tanHalfX = tanHalfY * aspect;
+
+	for (std::vector<float>* v : { &boxMinX, &boxMinY, &boxMinZ, &boxMaxX, &boxMaxY, &boxMaxZ })
+		v->resize(CLUSTER_COUNT);
+	for (int z = 0; z < GRID_Z; z++)
+	{
+		// Fatia z vai de near * (far/near)^(z/GRID_Z) at a prxima
+		float d0 = nearPlane * std::pow(farPlane / nearPlane, (float)z / GRID_Z);
+		float d1 = nearPlane * std::pow(farPlane / nearPlane, (float)(z + 1) / GRID_Z);
+		for (int y = 0; y < GRID_Y; y++)
+		{
+			float y0 = (-1.0f + 2.0f * y / GRID_Y) * tanHalfY, y1 = (-1.0f + 2.0f * (y + 1) / GRID_Y) * tanHalfY;
+			for (int x = 0; x < GRID_X; x++)
+			{
+				float x0 = (-1.0f + 2.0f * x / GRID_X) * tanHalfX, x1 = (-1.0f + 2.0f * (x + 1) / GRID_X) * tanHalfX;
+				// Caixa dos 8 cantos do pedao de frustum (a cmera olha para -z)
+				int c = (z * GRID_Y + y) * GRID_X + x;
+				boxMinX[c] = std::min(x0 * d0, x0 * d1);
+				boxMaxX[c] = std::max(x1 * d0, x1 * d1);
+				boxMinY[c] = std::min(y0 * d0, y0 * d1);
+				boxMaxY[c] = std::max(y1 * d0, y1 * d1);
+				boxMinZ[c] = -d1;
+				boxMaxZ[c] = -d0;
+			}
+		}
+	}
+}
+
+void ClusteredLighting::clear()
+{
+	lights.clear();
+}
+
+bool ClusteredLighting::addLight(const glm::vec3& position, float radius, const glm::vec3& color, float intensity)
+{
+	if ((int)lights.size() >= MAX_LIGHTS)
+		return false;
+	GpuLight light;
+	light.positionRadius = glm::vec4(position, radius);
+	light.color = glm::vec4(color * intensity, 0.0f);
+	lights.push_back(light);
+	return true;
+}
+
+int ClusteredLighting::depthSlice(float depth) const
+{
+	int slice = (int)std::floor(std::log(std::max(depth, nearPlane) / nearPlane) * sliceScale);
+	return std::min(std::max(slice, 0), GRID_Z - 1);
+}
+
+void ClusteredLighting::assign(const glm::mat4& view, Mode mode, bool threaded)
+{
+	PROFILE_ZONE("ClusteredLighting::assign");
+	auto start = std::chrono::high_resolution_clock::now();
+	stats = ClusterStats();
+	stats.lights = (int)lights.size();
+
+	// Luzes no espao da cmera, com o bloco de clusters que a esfera projetada cobre
+	viewLights.clear();
+	for (int i = 0; i < (int)lights.size(); i++)
+	{
+		glm::vec4 center = view * glm::vec4(glm::vec3(lights[i].positionRadius), 1.0f);
+		float radius = lights[i].positionRadius.w;
+		float depth = -center.z;
+		if (depth + radius < nearPlane || depth - radius > farPlane)
+			continue;
+
+		// x / profundidade  montono na profundidade, ento os extremos da
+		// esfera ficam na profundidade mais prxima ou na mais distante dela
+		float nearest = std::max(depth - radius, nearPlane), farthest = std::max(depth + radius, nearPlane);
+		float minX = std::min((center.x - radius) / nearest, (center.x - radius) / farthest) / tanHalfX;
+		float maxX = std::max((center.x + radius) / nearest, (center.x + radius) / farthest) / tanHalfX;
+		float minY = std::min((center.y - radius) / nearest, (center.y - radius) / farthest) / tanHalfY;
+		float maxY = std::max((center.y + radius) / nearest, (center.y + radius) / farthest) / tanHalfY;
+		if (maxX < -1.0f || minX > 1.0f || maxY < -1.0f || minY > 1.0f)
+			continue;
+
+		ViewLight light;
+		light.x = center.x;
+		light.y = center.y;
+		light.z = center.z;
+		light.radius = radius;
+		light.minX = std::max(0, (int)std::floor((minX + 1.0f) * 0.5f * GRID_X));
+		light.maxX = std::min(GRID_X - 1, (int)std::floor((maxX + 1.0f) * 0.5f * GRID_X));
+		light.minY = std::max(0, (int)std::floor((minY + 1.0f) * 0.5f * GRID_Y));
+		light.maxY = std::min(GRID_Y - 1, (int)std::floor((maxY + 1.0f) * 0.5f * GRID_Y));
+		light.minZ = depthSlice(depth - radius);
+		light.maxZ = depthSlice(std::min(depth + radius, farPlane));
+		light.light = (uint16_t)i;
+		viewLights.push_back(light);
+	}
+	stats.visibleLights = (int)viewLights.size();
+
+	std::fill(clusterCounts.begin(), clusterCounts.end(), 0);
+	std::fill(sliceOverflows.begin(), sliceOverflows.end(), 0);
+	if (threaded)
+		jobSystem.parallelFor(GRID_Z, 1, [&](int begin, int end) {
+			for (int slice = begin; slice < end; slice++)
+				assignSlice(slice, mode);
+		});
+	else
+		for (int slice = 0; slice < GRID_Z; slice++)
+			assignSlice(slice, mode);
+
+	// Compacta: cada cluster vira (incio, quantidade) numa lista s
+	indices.clear();
+	for (int c = 0; c < CLUSTER_COUNT; c++)
+	{
+		int count = clusterCounts[c];
+		grid[c * 2] = (uint32_t)indices.size();
+		grid[c * 2 + 1] = (uint32_t)count;
+		const uint16_t* items = &clusterItems[(size_t)c * MAX_LIGHTS_PER_CLUSTER];
+		indices.insert(indices.end(), items, items + count);
+		stats.maxPerCluster = std::max(stats.maxPerCluster, count);
+	}
+	stats.references = (int)indices.size();
+	for (int overflow : sliceOverflows)
+		stats.overflows += overflow;
+	stats.assignMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+}
+
+void ClusteredLighting::assignSlice(int slice, Mode mode)
+{
+	int overflows = 0;
+	auto append = [&](int cluster, uint16_t light) {
+		int& count = clusterCounts[cluster];
+		if (count < MAX_LIGHTS_PER_CLUSTER)
+			clusterItems[(size_t)cluster * MAX_LIGHTS_PER_CLUSTER + count++] = light;
+		else
+			overflows++;
+	};
+
+	for (const ViewLight& light : viewLights)
+	{
+		if (slice < light.minZ || slice > light.maxZ)
+			continue;
+		float radius2 = light.radius * light.radius;
+		for (int y = light.minY; y <= light.maxY; y++)
+		{
+			int row = (slice * GRID_Y + y) * GRID_X;
+#if defined(CG_CLUSTER_AVX)
+			if (mode == MODE_SIMD)
+			{
+				// Distncia da esfera  caixa: o quanto o centro sai da caixa em cada eixo
+				const __m256 zero = _mm256_setzero_ps();
+				__m256 cx = _mm256_set1_ps(light.x), cy = _mm256_set1_ps(light.y), cz = _mm256_set1_ps(light.z);
+				__m256 r2 = _mm256_set1_ps(radius2);
+				for (int block = light.minX & ~7; block <= light.maxX; block += 8)
+				{
+					int c = row + block;
+					__m256 dx = _mm256_max_ps(_mm256_max_ps(_mm256_sub_ps(_mm256_loadu_ps(&boxMinX[c]), cx), _mm256_sub_ps(cx, _mm256_loadu_ps(&boxMaxX[c]))), zero);
+					__m256 dy = _mm256_max_ps(_mm256_max_ps(_mm256_sub_ps(_mm256_loadu_ps(&boxMinY[c]), cy), _mm256_sub_ps(cy, _mm256_loadu_ps(&boxMaxY[c]))), zero);
+					__m256 dz = _mm256_max_ps(_mm256_max_ps(_mm256_sub_ps(_mm256_loadu_ps(&boxMinZ[c]), cz), _mm256_sub_ps(cz, _mm256_loadu_ps(&boxMaxZ[c]))), zero);
+					__m256 d2 = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)), _mm256_mul_ps(dz, dz));
+					int mask = _mm256_movemask_ps(_mm256_cmp_ps(d2, r2, _CMP_LE_OQ));
+					// S as colunas dentro do bloco da luz
+					int first = std::max(light.minX - block, 0), last = std::min(light.maxX - block, 7);
+					mask &= ((1 << (last + 1)) - 1) & ~((1 << first) - 1);
+					while (mask)
+					{
+						int lane = 0;
+						while (!(mask & (1 << lane)))
+							lane++;
+						append(c + lane, light.light);
+						mask &= mask - 1;
+					}
+				}
+				continue;
+			}
+#endif
+			for (int x = light.minX; x <= light.maxX; x++)
+			{
+				int c = row + x;
+				float dx = std::max(std::max(boxMinX[c] - light.x, light.x - boxMaxX[c]), 0.0f);
+				float dy = std::max(std::max(boxMinY[c] - light.y, light.y - boxMaxY[c]), 0.0f);
+				float dz = std::max(std::max(boxMinZ[c] - light.z, light.z - boxMaxZ[c]), 0.0f);
+				if (dx * dx + dy * dy + dz * dz <= radius2)
+					append(c, light.light);
+			}
+		}
+	}
+	sliceOverflows[slice] = overflows;
+}
+
+void ClusteredLighting::upload()
+{
+	PROFILE_ZONE("ClusteredLighting::upload");
+	if (lightBuffer == 0)
+		return;
+	// O contedo do quadro anterior pode estar em uso: descarta em vez de esperar
+	if (!lights.empty())
+	{
+		glDevice.orphanBuffer(lightBuffer, MAX_LIGHTS * sizeof(GpuLight));
+		glDevice.updateBuffer(lightBuffer, 0, lights.size() * sizeof(GpuLight), lights.data());
+	}
+	glDevice.orphanBuffer(gridBuffer, CLUSTER_COUNT * 2 * sizeof(uint32_t));
+	glDevice.updateBuffer(gridBuffer, 0, grid.size() * sizeof(uint32_t), grid.data());
+	if (!indices.empty())
+	{
+		glDevice.orphanBuffer(indexBuffer, (GLsizeiptr)CLUSTER_COUNT * MAX_LIGHTS_PER_CLUSTER * sizeof(uint16_t));
+		glDevice.updateBuffer(indexBuffer, 0, indices.size() * sizeof(uint16_t), indices.data());
+	}
+	PROFILE_UPLOAD((lights.size() * sizeof(GpuLight)) + grid.size() * sizeof(uint32_t) + indices.size() * sizeof(uint16_t));
+}
+
+void ClusteredLighting::apply(Shader* shader) const
+{
+	glState.bindTexture(TEXTURE_UNIT, GL_TEXTURE_BUFFER, lightTexture);
+	glState.bindTexture(TEXTURE_UNIT + 1, GL_TEXTURE_BUFFER, gridTexture);
+	glState.bindTexture(TEXTURE_UNIT + 2, GL_TEXTURE_BUFFER, indexTexture);
+	shader->setInt("clusterLights", TEXTURE_UNIT);
+	shader->setInt("clusterGrid", TEXTURE_UNIT + 1);
+	shader->setInt("clusterIndices", TEXTURE_UNIT + 2);
+	shader->setVec4("clusterScreen", (float)screenWidth / GRID_X, (float)screenHeight / GRID_Y, (float)GRID_X, (float)GRID_Y);
+	shader->setVec4("clusterDepth", nearPlane, farPlane, sliceScale, (float)GRID_Z);
+}
+
+int ClusteredLighting::clusterLightCount(int x, int y, int z) const
+{
+	return clusterCounts[(z * GRID_Y + y) * GRID_X + x];
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+//GLAD
+#include <glad/glad.h>
+
+//GLM
+#include <glm/glm.hpp>
+
+#include "Shader.h"
+
+// Estatsticas de um quadro do ClusteredLighting
+struct ClusterStats
+{
+	int lights = 0; //Luzes adicionadas
+	int visibleLights = 0; //As que tocam o frustum
+	int references = 0; //Pares cluster-luz
+	int maxPerCluster = 0;
+	int overflows = 0; //Pares que no couberam em MAX_LIGHTS_PER_CLUSTER
+	double assignMs = 0.0;
+};
+
+// Iluminao forward em clusters: o frustum da cmera  dividido numa grade de
+// GRID_X x GRID_Y ladrilhos na tela por GRID_Z fatias de profundidade (em escala
+// logartmica, mais finas perto da cmera). A cada quadro assign() pe cada luz
+// pontual nos clusters que a esfera dela toca, e o shader (variante CLUSTERED,
+// shaders/include/clustered.glsl) acha o cluster do fragmento pela posio na
+// tela e pela profundidade e s percorre as luzes dele. O custo por pixel
+// acompanha as luzes que chegam nele, no o total de luzes da cena.
+//
+// A distribuio  na CPU: as caixas dos clusters (no espao da cmera) saem de
+// setProjection(), cada luz  limitada a um bloco de clusters pela projeo da
+// esfera, e o teste esfera x caixa dentro do bloco  feito 8 clusters por vez
+// com AVX. As fatias so repartidas entre as threads do jobSystem (cada fatia s
+// escreve nos seus clusters). O resultado vai para a GPU em trs texturas de
+// buffer (existem desde a 3.1, ento o mesmo caminho serve na 3.3 e na 4.5).
+class ClusteredLighting
+{
+public:
+	static const int GRID_X = 16;
+	static const int GRID_Y = 9;
+	static const int GRID_Z = 24;
+	static const int CLUSTER_COUNT = GRID_X * GRID_Y * GRID_Z;
+	static const int MAX_LIGHTS = 4096;
+	static const int MAX_LIGHTS_PER_CLUSTER = 128;
+	// Primeira unidade de textura usada (luzes, grade e ndices nas trs seguintes)
+	static const int TEXTURE_UNIT = 4;
+
+	enum Mode
+	{
+		MODE_SCALAR, //Um cluster por vez (referncia para comparar)
+		MODE_SIMD //8 clusters de uma linha por vez com AVX (escalar sem AVX)
+	};
+
+	ClusteredLighting();
+	~ClusteredLighting();
+
+	// Cria os buffers e as texturas (precisa do contexto OpenGL; assign() funciona sem)
+	void init();
+	void release();
+
+	// Monta as caixas dos clusters; chamar quando a projeo ou o tamanho da tela mudar
+	void setProjection(float fovY, float aspect, float nearPlane, float farPlane, int screenWidth, int screenHeight);
+
+	void clear();
+	// Luz pontual no mundo; no ilumina nada alm de 'radius'. Retorna false se j h MAX_LIGHTS.
+	bool addLight(const glm::vec3& position, float radius, const glm::vec3& color, float intensity = 1.0f);
+	int lightCount() const { return (int)lights.size(); }
+
+	// Distribui as luzes nos clusters, com a cmera do quadro
+	void assign(const glm::mat4& view, Mode mode = MODE_SIMD, bool threaded = true);
+	// Envia luzes, grade e lista de ndices do ltimo assign()
+	void upload();
+	// Liga as texturas e manda os uniforms para a variante CLUSTERED ativa
+	void apply(Shader* shader) const;
+
+	// Luzes no cluster (x, y, z) depois do ltimo assign()
+	int clusterLightCount(int x, int y, int z) const;
+	const ClusterStats& frameStats() const { return stats; }
+
+	// Nome do caminho SIMD compilado ("AVX" ou "escalar")
+	static const char* simdName();
+
+protected:
+	// Como a luz chega na GPU (2 texels RGBA32F)
+	struct GpuLight
+	{
+		glm::vec4 positionRadius;
+		glm::vec4 color;
+	};
+
+	// Luz j no espao da cmera e o bloco de clusters que a esfera pode tocar
+	struct ViewLight
+	{
+		float x, y, z, radius;
+		int minX, maxX, minY, maxY, minZ, maxZ;
+		uint16_t light; //ndice em 'lights'
+	};
+
+	void assignSlice(int slice, Mode mode);
+	// Fatia da profundidade (distncia ao longo da direo de viso), limitada  grade
+	int depthSlice(float depth) const;
+
+	float nearPlane, farPlane;
+	float sliceScale; //GRID_Z / log(far / near)
+	float tanHalfX, tanHalfY; //Meia largura e meia altura do frustum a uma unidade da cmera
+	int screenWidth, screenHeight;
+	// Caixas dos clusters no espao da cmera (SoA), ndice (z * GRID_Y + y) * GRID_X + x
+	std::vector<float> boxMinX, boxMinY, boxMinZ, boxMaxX, boxMaxY, boxMaxZ;
+
+	std::vector<GpuLight> lights;
+	std::vector<ViewLight> viewLights;
+	// At MAX_LIGHTS_PER_CLUSTER luzes por cluster, antes de compactar
+	std::vector<uint16_t> clusterItems;
+	std::vector<int> clusterCounts;
+	std::vector<int> sliceOverflows;
+	// Compactado para a GPU: (incio, quantidade) por cluster e a lista de ndices
+	std::vector<uint32_t> grid;
+	std::vector<uint16_t> indices;
+
+	GLuint lightBuffer, gridBuffer, indexBuffer;
+	GLuint lightTexture, gridTexture, indexTexture;
+	ClusterStats stats;
+};
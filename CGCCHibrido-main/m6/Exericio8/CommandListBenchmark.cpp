@@ -0,0 +1,154 @@
+#include "CommandListBenchmark.h"
+
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+//GLM
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include "GLDevice.h"
+#include "GLState.h"
+#include "JobSystem.h"
+#include "FrustumCuller.h"
+#include "RenderQueue.h"
+#include "StreamBuffer.h"
+
+// Mdias de uma rodada, em ms da thread principal
+struct CommandListResult
+{
+	double recordMs = 0.0; //Matrizes, culling e submisso (ou espera pelo record())
+	double flushMs = 0.0; //Juno das listas, trocas de estado e draws
+	double frameMs = 0.0; //Quadro inteiro, com o swap
+	int drawn = 0;
+};
+
+static CommandListResult runRound(GLFWwindow* window, ShaderVariantCache& shaders, RenderQueue& queue, StreamBuffer& stream,
+	const GeometryBuffers& buffers, const Geometry& cube, const Material& material, int count, bool parallel, int frames)
+{
+	int side = (int)std::ceil(std::cbrt((double)count));
+	float distance = side * 1.5f * 1.2f + 3.0f;
+	glm::vec3 eye(distance, distance * 0.6f, distance * 0.5f);
+	glm::mat4 view = glm::lookAt(eye, glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+	int width, height;
+	glfwGetFramebufferSize(window, &width, &height);
+	glm::mat4 projection = glm::perspective(glm::radians(45.0f), (float)width / (float)height, 0.1f, distance * 4.0f);
+	Frustum frustum = Frustum::fromMatrix(projection * view);
+
+	auto setupShader = [&](Shader* shader) {
+		shader->setMat4("view", glm::value_ptr(view));
+		shader->setMat4("projection", glm::value_ptr(projection));
+		shader->setVec3("lightPos", distance, distance, distance);
+		shader->setVec3("viewPos", eye.x, eye.y, eye.z);
+		shader->setVec3("lightColor", 1.0f, 1.0f, 1.0f);
+	};
+
+	// Trabalho de CPU de um objeto: matriz, caixa no mundo e teste contra o frustum
+	float time = 0.0f;
+	auto objectModel = [&](int i, glm::mat4& model) {
+		int x = i % side, y = (i / side) % side, z = i / (side * side);
+		glm::vec3 position = (glm::vec3(x, y, z) - glm::vec3((side - 1) * 0.5f)) * 1.5f;
+		model = glm::translate(glm::mat4(1.0f), position);
+		model = glm::rotate(model, time + i * 0.1f, glm::vec3(0.0f, 1.0f, 0.0f));
+		model = glm::scale(model, glm::vec3(0.5f));
+		return frustum.classify(cube.bounds.transformed(model)) != Frustum::OUTSIDE;
+	};
+
+	CommandListResult result;
+	for (int frame = 0; frame < frames; frame++)
+	{
+		double frameStart = glfwGetTime();
+		glfwPollEvents();
+		glState.beginFrame();
+		stream.beginFrame();
+		glClearColor(1.0f, 1.0f, 1.0f, 1.0f);
+		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+		time = frame * 0.02f;
+		queue.begin(view, distance * 4.0f);
+		if (parallel)
+		{
+			queue.record(count, std::max(256, count / (4 * (jobSystem.workerCount() + 1))), [&](CommandList& list, int begin, int end) {
+				glm::mat4 model;
+				for (int i = begin; i < end; i++)
+					if (objectModel(i, model))
+						list.submit(PASS_OPAQUE, buffers.vao, buffers.indexCount, material, model);
+			});
+		}
+		else
+		{
+			glm::mat4 model;
+			for (int i = 0; i < count; i++)
+				if (objectModel(i, model))
+					queue.submit(PASS_OPAQUE, buffers.vao, buffers.indexCount, material, model);
+		}
+		double recorded = glfwGetTime();
+		int drawn = queue.size();
+		queue.flush(shaders, setupShader);
+		double flushed = glfwGetTime();
+		stream.endFrame();
+
+		glfwSwapBuffers(window);
+
+		// O primeiro quadro paga compilao de shader e alocao das listas
+		if (frame == 0)
+			continue;
+		result.recordMs += (recorded - frameStart) * 1000.0;
+		result.flushMs += (flushed - recorded) * 1000.0;
+		result.frameMs += (glfwGetTime() - frameStart) * 1000.0;
+		result.drawn = drawn;
+	}
+	glFinish();
+
+	int measured = std::max(1, frames - 1);
+	result.recordMs /= measured;
+	result.flushMs /= measured;
+	result.frameMs /= measured;
+	return result;
+}
+
+static void printRow(const char* path, int workers, const CommandListResult& result)
+{
+	std::cout << std::setw(12) << path << std::setw(9) << workers << std::setw(9) << result.drawn << std::fixed << std::setprecision(3)
+		<< std::setw(12) << result.recordMs << std::setw(12) << result.flushMs << std::setw(12) << result.frameMs << std::endl;
+}
+
+void runCommandListBenchmark(GLFWwindow* window, ShaderVariantCache& shaders, const Geometry& cube, const Material& material, int objects)
+{
+	GeometryBuffers buffers = uploadGeometry(cube);
+	RenderQueue queue;
+	StreamBuffer stream;
+	// Lugar para a matriz de todos os objetos, alinhada para glBindBufferRange
+	GLint alignment = 256;
+	glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+	stream.init((GLsizeiptr)objects * std::max((GLint)sizeof(glm::mat4), alignment));
+	queue.setStreamBuffer(&stream);
+
+	glState.enable(GL_DEPTH_TEST, true);
+	glfwSwapInterval(0);
+	int frames = std::max(10, std::min(60, 2000000 / objects));
+
+	std::cout << "Benchmark de gravacao de comandos (" << glDevice.backendName() << "), " << objects << " objetos, medias em ms por quadro da thread principal" << std::endl;
+	std::cout << std::setw(12) << "caminho" << std::setw(9) << "threads" << std::setw(9) << "draws" << std::setw(12) << "gravar"
+		<< std::setw(12) << "flush" << std::setw(12) << "quadro" << std::endl;
+
+	printRow("submit", 0, runRound(window, shaders, queue, stream, buffers, cube, material, objects, false, frames));
+	int maxWorkers = std::max(0, (int)std::thread::hardware_concurrency() - 1);
+	for (int workers = 0; !glfwWindowShouldClose(window); workers = workers * 2 + 1)
+	{
+		workers = std::min(workers, maxWorkers);
+		jobSystem.start(workers);
+		printRow("record", workers, runRound(window, shaders, queue, stream, buffers, cube, material, objects, true, frames));
+		if (workers == maxWorkers)
+			break;
+	}
+	// Volta ao nmero padro de threads
+	jobSystem.start();
+
+	stream.release();
+	buffers.release();
+}
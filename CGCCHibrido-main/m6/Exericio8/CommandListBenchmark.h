@@ -0,0 +1,14 @@
+#pragma once
+
+#include "Geometry.h"
+#include "Material.h"
+
+//GLFW (depois da GLAD)
+#include <GLFW/glfw3.h>
+
+// Benchmark da gravao de comandos em paralelo: 'objects' cubos girando, cada
+// um com a sua matriz, teste de frustum e um draw na RenderQueue. Compara o
+// submit() na thread do GL com o record() dividido entre 0, 1, 3... threads de
+// trabalho, e imprime o tempo da thread principal para gravar, para o flush()
+// (juno das listas e os draws) e para o quadro inteiro.
+void runCommandListBenchmark(GLFWwindow* window, ShaderVariantCache& shaders, const Geometry& cube, const Material& material, int objects = 20000);
@@ -0,0 +1,85 @@
+#pragma once
+
+//GLAD
+#include <glad/glad.h>
+
+//GLM
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include "Bounds.h"
+
+struct Geometry;
+struct Material;
+
+// Componentes da cena. Um objeto desenhvel (o antigo Mesh)  uma entidade com
+// Transform + MeshRef + MaterialRef + Bounds; Velocity  opcional. Uma luz
+// pontual  Transform + PointLight. O que a simulao move em passos fixos
+// tem tambm um MotionState.
+
+// N da entidade na TransformHierarchy da cena (local e matriz de mundo ficam l)
+struct Transform
+{
+	int node = -1;
+};
+
+// Geometria j enviada para a GPU
+struct MeshRef
+{
+	GLuint vao = 0;
+	GLuint depthVao = 0; //S posies, para o pr-passo de profundidade (0 = usa vao)
+	int indexCount = 0;
+};
+
+struct MaterialRef
+{
+	const Material* material = nullptr;
+};
+
+// Limites no espao do objeto e no de mundo, e o objeto no SceneTree da cena
+struct Bounds
+{
+	AABB local, world;
+	BoundingSphere localSphere, worldSphere;
+	glm::vec3 displacement = glm::vec3(0.0f); //Do centro de mundo no ltimo updateWorldBounds
+	int proxyId = -1; //SCENE_TREE_NULL = fora da rvore
+};
+
+// Marca um objeto desenhvel que nunca se move: a sombra dele fica nas pginas
+// em cache do CascadedShadows em vez de ser redesenhada todo quadro
+struct StaticMesh
+{
+};
+
+// Marca um objeto desenhvel como oclusor da ocluso na CPU (paredes, prdios, os objetos
+// grandes da cena): 'geometry' (a cpia na CPU da malha ou uma verso simplificada dela) 
+// rasterizada com a matriz de mundo do Transform. O resto s  testado contra eles.
+struct Occluder
+{
+	const Geometry* geometry = nullptr;
+};
+
+// Local do Transform do lado da simulao: os passos fixos mexem em 'position',
+// 'rotation' e 'scale', e o Transform recebe a cada quadro a interpolao entre
+// o estado do passo anterior e o atual (interpolateMotion)
+struct MotionState
+{
+	glm::vec3 position = glm::vec3(0.0f), previousPosition = glm::vec3(0.0f);
+	glm::quat rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f), previousRotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+	glm::vec3 scale = glm::vec3(1.0f), previousScale = glm::vec3(1.0f);
+};
+
+// Movimento contnuo aplicado ao MotionState a cada passo da simulao
+struct Velocity
+{
+	glm::vec3 linear = glm::vec3(0.0f); //Unidades por segundo
+	glm::vec3 angular = glm::vec3(0.0f); //Eixo * radianos por segundo
+};
+
+// Luz pontual na posio do Transform, entregue ao ClusteredLighting
+struct PointLight
+{
+	glm::vec3 color = glm::vec3(1.0f);
+	float intensity = 1.0f;
+	float radius = 1.0f; //Alm daqui a luz no ilumina nada
+};
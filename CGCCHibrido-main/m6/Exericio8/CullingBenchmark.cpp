@@ -0,0 +1,334 @@
+#include "CullingBenchmark.h"
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+
+//GLM
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "Camera.h"
+#include "FrustumCuller.h"
+#include "JobSystem.h"
+#include "OcclusionCuller.h"
+#include "SceneTree.h"
+
+static double elapsedMs(std::chrono::high_resolution_clock::time_point start)
+{
+	return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+}
+
+static double cullMs(FrustumCuller& culler, const std::vector<Frustum>& frustums, FrustumCuller::Mode mode, bool threaded, long long& visibleTotal)
+{
+	visibleTotal = 0;
+	auto start = std::chrono::high_resolution_clock::now();
+	for (const Frustum& frustum : frustums)
+		visibleTotal += culler.cull(frustum, mode, threaded);
+	auto end = std::chrono::high_resolution_clock::now();
+	return std::chrono::duration<double, std::milli>(end - start).count() / frustums.size();
+}
+
+void runCullingBenchmark(int objects)
+{
+	const int ITERATIONS = 200;
+	const float WORLD_SIZE = 400.0f;
+
+	// Caixas de 0.5 a 4 unidades espalhadas num cubo de lado WORLD_SIZE em volta da origem
+	std::mt19937 random(1234);
+	std::uniform_real_distribution<float> position(-WORLD_SIZE * 0.5f, WORLD_SIZE * 0.5f);
+	std::uniform_real_distribution<float> size(0.25f, 2.0f);
+	FrustumCuller culler;
+	std::vector<AABB> boxes;
+	for (int i = 0; i < objects; i++)
+	{
+		glm::vec3 center(position(random), position(random), position(random));
+		AABB box;
+		box.min = center - glm::vec3(size(random), size(random), size(random));
+		box.max = center + glm::vec3(size(random), size(random), size(random));
+		culler.add(box);
+		boxes.push_back(box);
+	}
+
+	// Uma cmera no centro dando uma volta completa
+	std::vector<Frustum> frustums;
+	glm::mat4 projection = glm::perspective(glm::radians(45.0f), 16.0f / 9.0f, 0.1f, WORLD_SIZE * 0.5f);
+	for (int i = 0; i < ITERATIONS; i++)
+	{
+		Camera camera(glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f), 360.0f * i / ITERATIONS, 10.0f);
+		frustums.push_back(Frustum::fromMatrix(projection * camera.GetViewMatrix()));
+	}
+
+	std::cout << "Benchmark de frustum culling: " << objects << " objetos, SIMD " << FrustumCuller::simdName()
+		<< ", " << jobSystem.workerCount() << " threads de trabalho + a principal" << std::endl;
+	std::cout << std::setw(22) << "caminho" << std::setw(12) << "ms" << std::setw(14) << "visiveis" << std::endl;
+
+	struct Path
+	{
+		const char* name;
+		FrustumCuller::Mode mode;
+		bool threaded;
+	};
+	const Path paths[] = {
+		{ "escalar", FrustumCuller::MODE_SCALAR, false },
+		{ "escalar + threads", FrustumCuller::MODE_SCALAR, true },
+		{ "SIMD", FrustumCuller::MODE_SIMD, false },
+		{ "SIMD + threads", FrustumCuller::MODE_SIMD, true }
+	};
+
+	// O escalar  a referncia: todo caminho tem que marcar os mesmos objetos
+	culler.cull(frustums[0], FrustumCuller::MODE_SCALAR, false);
+	std::vector<bool> reference(objects);
+	for (int i = 0; i < objects; i++)
+		reference[i] = culler.visible(i);
+
+	for (const Path& path : paths)
+	{
+		long long visibleTotal;
+		// Uma rodada para aquecer cache e threads
+		cullMs(culler, frustums, path.mode, path.threaded, visibleTotal);
+		double ms = cullMs(culler, frustums, path.mode, path.threaded, visibleTotal);
+
+		culler.cull(frustums[0], path.mode, path.threaded);
+		int mismatches = 0;
+		for (int i = 0; i < objects; i++)
+			if (culler.visible(i) != reference[i])
+				mismatches++;
+
+		std::cout << std::setw(22) << path.name << std::fixed << std::setprecision(4) << std::setw(12) << ms
+			<< std::setw(14) << visibleTotal / ITERATIONS;
+		if (mismatches > 0)
+			std::cout << "  (" << mismatches << " diferentes do escalar!)";
+		std::cout << std::endl;
+	}
+
+	// Mesmos objetos numa BVH. A caixa folgada s pode aceitar a mais, nunca perder um visvel
+	auto start = std::chrono::high_resolution_clock::now();
+	SceneTree tree;
+	std::vector<int> proxies(objects);
+	for (int i = 0; i < objects; i++)
+		proxies[i] = tree.createProxy(boxes[i], (void*)(intptr_t)i);
+	double insertMs = elapsedMs(start);
+
+	std::cout << std::endl << "BVH dinamica: insercao " << std::setprecision(1) << insertMs << " ms, altura " << tree.getHeight()
+		<< ", razao de area " << tree.areaRatio() << std::endl;
+
+	start = std::chrono::high_resolution_clock::now();
+	tree.rebuild();
+	double rebuildMs = elapsedMs(start);
+	std::cout << "reconstrucao SAH " << rebuildMs << " ms, altura " << tree.getHeight() << ", razao de area " << tree.areaRatio()
+		<< (tree.validate() ? "" : "  (arvore invalida!)") << std::endl;
+
+	std::vector<bool> found(objects);
+	long long visibleTotal = 0;
+	start = std::chrono::high_resolution_clock::now();
+	for (const Frustum& frustum : frustums)
+		tree.queryFrustum(frustum, [&](int) { visibleTotal++; return true; });
+	double frustumMs = elapsedMs(start) / ITERATIONS;
+
+	tree.queryFrustum(frustums[0], [&](int proxyId) { found[(intptr_t)tree.getUserData(proxyId)] = true; return true; });
+	int missing = 0;
+	for (int i = 0; i < objects; i++)
+		if (reference[i] && !found[i])
+			missing++;
+	std::cout << std::setw(22) << "BVH frustum" << std::setprecision(4) << std::setw(12) << frustumMs << std::setw(14) << visibleTotal / ITERATIONS;
+	if (missing > 0)
+		std::cout << "  (" << missing << " visiveis perdidos!)";
+	std::cout << std::endl;
+
+	// Esferas de raio 10 e raios de 100 unidades em pontos aleatrios (picking / consulta de vizinhana)
+	std::uniform_real_distribution<float> direction(-1.0f, 1.0f);
+	long long hits = 0;
+	start = std::chrono::high_resolution_clock::now();
+	for (int i = 0; i < ITERATIONS; i++)
+	{
+		BoundingSphere sphere;
+		sphere.center = glm::vec3(position(random), position(random), position(random));
+		sphere.radius = 10.0f;
+		tree.querySphere(sphere, [&](int) { hits++; return true; });
+	}
+	double sphereMs = elapsedMs(start) / ITERATIONS;
+	std::cout << std::setw(22) << "BVH esfera" << std::setw(12) << sphereMs << std::setw(14) << hits / ITERATIONS << std::endl;
+
+	hits = 0;
+	start = std::chrono::high_resolution_clock::now();
+	for (int i = 0; i < ITERATIONS; i++)
+	{
+		SceneRay ray;
+		ray.origin = glm::vec3(position(random), position(random), position(random));
+		ray.direction = 100.0f * glm::normalize(glm::vec3(direction(random), direction(random), direction(random)));
+		// S o acerto mais prximo: cada caixa atingida encurta o raio
+		bool hit = false;
+		tree.rayCast(ray, [&](int proxyId, const SceneRay& subRay) {
+			const AABB& box = boxes[(intptr_t)tree.getUserData(proxyId)];
+			glm::vec3 t1 = (box.min - subRay.origin) / subRay.direction, t2 = (box.max - subRay.origin) / subRay.direction;
+			glm::vec3 tNear = glm::min(t1, t2), tFar = glm::max(t1, t2);
+			float enter = std::max(std::max(tNear.x, tNear.y), std::max(tNear.z, 0.0f));
+			float exit = std::min(std::min(tFar.x, tFar.y), tFar.z);
+			if (enter > exit || enter > subRay.maxFraction)
+				return -1.0f;
+			hit = true;
+			return std::max(enter, 1e-6f);
+		});
+		if (hit)
+			hits++;
+	}
+	double rayMs = elapsedMs(start) / ITERATIONS;
+	std::cout << std::setw(22) << "BVH raio" << std::setw(12) << rayMs << std::setw(14) << hits << " acertos" << std::endl;
+
+	// 10% dos objetos andando a cada quadro, com refit e a reconstruo quando a rvore piora
+	const int FRAMES = 100;
+	std::uniform_int_distribution<int> pick(0, objects - 1);
+	int moved = 0, rebuilds = 0;
+	start = std::chrono::high_resolution_clock::now();
+	for (int frame = 0; frame < FRAMES; frame++)
+	{
+		for (int k = 0; k < objects / 10; k++)
+		{
+			int i = pick(random);
+			glm::vec3 displacement(direction(random), direction(random), direction(random));
+			boxes[i].min += displacement;
+			boxes[i].max += displacement;
+			if (tree.moveProxy(proxies[i], boxes[i], displacement))
+				moved++;
+		}
+		if (tree.maintain())
+			rebuilds++;
+	}
+	double moveMs = elapsedMs(start) / FRAMES;
+	std::cout << std::setw(22) << "BVH mover 10%" << std::setw(12) << moveMs << std::setw(14) << moved / FRAMES
+		<< " refits, " << rebuilds << " reconstrucoes, razao de area " << std::setprecision(2) << tree.areaRatio()
+		<< (tree.validate() ? "" : "  (arvore invalida!)") << std::endl;
+}
+
+// Cubo [-1, 1] com as faces no sentido anti-horrio vistas de fora (canto i = bits x, y, z)
+static void boxOccluderMesh(std::vector<float>& positions, std::vector<unsigned>& indices)
+{
+	for (int i = 0; i < 8; i++)
+	{
+		positions.push_back((i & 1) ? 1.0f : -1.0f);
+		positions.push_back((i & 2) ? 1.0f : -1.0f);
+		positions.push_back((i & 4) ? 1.0f : -1.0f);
+	}
+	indices = { 0, 4, 6, 0, 6, 2, 1, 3, 7, 1, 7, 5, 0, 1, 5, 0, 5, 4, 2, 6, 7, 2, 7, 3, 0, 2, 3, 0, 3, 1, 4, 5, 7, 4, 7, 6 };
+}
+
+void runOcclusionBenchmark(int objects)
+{
+	const int ITERATIONS = 200;
+	const float WORLD_SIZE = 400.0f;
+	const int BLOCKS = 20;
+	const float BLOCK_SIZE = WORLD_SIZE / BLOCKS;
+
+	// Uma cidade: prdios no centro de cada quadra (menos a da cmera) e objetos pequenos no cho
+	std::mt19937 random(1234);
+	std::uniform_real_distribution<float> height(5.0f, 30.0f);
+	std::vector<glm::mat4> buildings;
+	std::vector<AABB> buildingBoxes;
+	for (int bz = 0; bz < BLOCKS; bz++)
+		for (int bx = 0; bx < BLOCKS; bx++)
+		{
+			glm::vec3 center(-WORLD_SIZE * 0.5f + (bx + 0.5f) * BLOCK_SIZE, 0.0f, -WORLD_SIZE * 0.5f + (bz + 0.5f) * BLOCK_SIZE);
+			if (glm::length(center) < BLOCK_SIZE)
+				continue;
+			glm::vec3 half(BLOCK_SIZE * 0.35f, height(random) * 0.5f, BLOCK_SIZE * 0.35f);
+			center.y = half.y;
+			buildings.push_back(glm::scale(glm::translate(glm::mat4(1.0f), center), half));
+			AABB box;
+			box.min = center - half;
+			box.max = center + half;
+			buildingBoxes.push_back(box);
+		}
+
+	std::uniform_real_distribution<float> position(-WORLD_SIZE * 0.5f, WORLD_SIZE * 0.5f);
+	std::uniform_real_distribution<float> size(0.25f, 1.0f);
+	FrustumCuller culler;
+	std::vector<AABB> boxes;
+	for (int i = 0; i < objects; i++)
+	{
+		glm::vec3 half(size(random), size(random), size(random));
+		glm::vec3 center(position(random), half.y, position(random));
+		AABB box;
+		box.min = center - half;
+		box.max = center + half;
+		culler.add(box);
+		boxes.push_back(box);
+	}
+
+	std::vector<float> boxPositions;
+	std::vector<unsigned> boxIndices;
+	boxOccluderMesh(boxPositions, boxIndices);
+
+	// Cmera na altura dos olhos no meio da cidade, dando uma volta; o buffer tem a proporo 2:1 dele
+	std::vector<glm::mat4> viewProjections;
+	glm::mat4 projection = glm::perspective(glm::radians(60.0f), (float)OcclusionCuller::WIDTH / OcclusionCuller::HEIGHT, 0.1f, WORLD_SIZE);
+	for (int i = 0; i < ITERATIONS; i++)
+	{
+		Camera camera(glm::vec3(0.0f, 1.7f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f), 360.0f * i / ITERATIONS, 0.0f);
+		viewProjections.push_back(projection * camera.GetViewMatrix());
+	}
+
+	std::cout << "Benchmark de oclusao na CPU: " << objects << " objetos, " << buildings.size() << " predios oclusores, buffer "
+		<< OcclusionCuller::WIDTH << "x" << OcclusionCuller::HEIGHT << " " << OcclusionCuller::simdName() << ", "
+		<< jobSystem.workerCount() << " threads de trabalho + a principal" << std::endl;
+
+	OcclusionCuller occlusion;
+	double frustumMs = 0.0, setupMs = 0.0, rasterMs = 0.0, serialMs = 0.0, testMs = 0.0;
+	long long frustumVisible = 0, occlusionVisible = 0, triangles = 0;
+	int differentPixels = 0;
+	std::vector<float> serialDepth;
+	for (const glm::mat4& viewProjection : viewProjections)
+	{
+		auto start = std::chrono::high_resolution_clock::now();
+		Frustum frustum = Frustum::fromMatrix(viewProjection);
+		frustumVisible += culler.cull(frustum);
+		frustumMs += elapsedMs(start);
+
+		// Referncia sem threads, para conferir que as faixas do o mesmo buffer
+		occlusion.beginFrame(viewProjection);
+		for (size_t b = 0; b < buildings.size(); b++)
+			if (frustum.intersects(buildingBoxes[b]))
+				occlusion.addOccluder(boxPositions.data(), 3, boxIndices.data(), (int)boxIndices.size(), buildings[b]);
+		start = std::chrono::high_resolution_clock::now();
+		occlusion.rasterize(false);
+		serialMs += elapsedMs(start);
+		serialDepth.assign(occlusion.depthBuffer(), occlusion.depthBuffer() + OcclusionCuller::WIDTH * OcclusionCuller::HEIGHT);
+
+		start = std::chrono::high_resolution_clock::now();
+		occlusion.beginFrame(viewProjection);
+		for (size_t b = 0; b < buildings.size(); b++)
+			if (frustum.intersects(buildingBoxes[b]))
+				occlusion.addOccluder(boxPositions.data(), 3, boxIndices.data(), (int)boxIndices.size(), buildings[b]);
+		setupMs += elapsedMs(start);
+		start = std::chrono::high_resolution_clock::now();
+		occlusion.rasterize(true);
+		rasterMs += elapsedMs(start);
+		for (int p = 0; p < OcclusionCuller::WIDTH * OcclusionCuller::HEIGHT; p++)
+			if (occlusion.depthBuffer()[p] != serialDepth[p])
+				differentPixels++;
+
+		start = std::chrono::high_resolution_clock::now();
+		for (int i = 0; i < objects; i++)
+			if (culler.visible(i) && occlusion.visible(boxes[i]))
+				occlusionVisible++;
+		testMs += elapsedMs(start);
+		triangles += occlusion.frameStats().rasterizedTriangles;
+	}
+
+	std::cout << std::fixed << std::setprecision(4);
+	std::cout << std::setw(30) << "frustum (SIMD + threads)" << std::setw(12) << frustumMs / ITERATIONS << " ms" << std::endl;
+	std::cout << std::setw(30) << "preparo dos oclusores" << std::setw(12) << setupMs / ITERATIONS << " ms, "
+		<< triangles / ITERATIONS << " triangulos" << std::endl;
+	std::cout << std::setw(30) << "rasterizacao" << std::setw(12) << serialMs / ITERATIONS << " ms" << std::endl;
+	std::cout << std::setw(30) << "rasterizacao + threads" << std::setw(12) << rasterMs / ITERATIONS << " ms";
+	if (differentPixels > 0)
+		std::cout << "  (" << differentPixels << " pixels diferentes do caminho sem threads!)";
+	std::cout << std::endl;
+	std::cout << std::setw(30) << "teste HiZ" << std::setw(12) << testMs / ITERATIONS << " ms" << std::endl;
+	std::cout << "visiveis por quadro: " << frustumVisible / ITERATIONS << " no frustum, " << occlusionVisible / ITERATIONS
+		<< " depois da oclusao (" << std::setprecision(1) << 100.0 * (frustumVisible - occlusionVisible) / std::max(1LL, frustumVisible)
+		<< "% escondidos)" << std::endl;
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+// Benchmark do FrustumCuller com 'objects' caixas espalhadas ao redor de uma
+// cmera que gira. Compara o caminho escalar com o SIMD, com e sem as threads
+// do jobSystem, confere que todos marcam os mesmos objetos como visveis e
+// imprime o tempo mdio por culling. No usa a OpenGL.
+void runCullingBenchmark(int objects = 100000);
+
+// Benchmark do OcclusionCuller: uma cmera girando no meio de uma cidade de
+// prdios (os oclusores) com 'objects' caixas pequenas no cho. Mede o frustum
+// culling, a rasterizao dos oclusores com e sem threads (conferindo que o
+// buffer sai igual), o teste HiZ e quantos objetos a ocluso esconde. No usa a OpenGL.
+void runOcclusionBenchmark(int objects = 100000);
@@ -0,0 +1,104 @@
+#include "DeferredRenderer.h"
+
+#include <iostream>
+#include <vector>
+
+//GLM
+#include <glm/gtc/type_ptr.hpp>
+
+#include "GLDevice.h"
+#include "GLState.h"
+#include "Profiler.h"
+
+DeferredRenderer::DeferredRenderer() : width(0), height(0), framebuffer(0), albedoTexture(0), normalTexture(0), depthTexture(0), emptyVao(0)
+{
+}
+
+DeferredRenderer::~DeferredRenderer()
+{
+	release();
+}
+
+bool DeferredRenderer::init(int width, int height)
+{
+	release();
+	this->width = width;
+	this->height = height;
+	albedoTexture = glDevice.createTexture2D(GL_RGBA8, width, height, 1);
+	normalTexture = glDevice.createTexture2D(GL_RG16F, width, height, 1);
+	// Mesmo formato da profundidade da tela, que o glBlitFramebuffer exige
+	depthTexture = glDevice.createTexture2D(GL_DEPTH24_STENCIL8, width, height, 1);
+	for (GLuint texture : { albedoTexture, normalTexture, depthTexture })
+	{
+		glDevice.textureParameter(texture, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glDevice.textureParameter(texture, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	}
+	framebuffer = glDevice.createFramebuffer({ albedoTexture, normalTexture }, depthTexture, GL_DEPTH_STENCIL_ATTACHMENT);
+	emptyVao = glDevice.createVertexArray({});
+	if (framebuffer == 0)
+	{
+		std::cout << "DeferredRenderer: G-buffer incompleto, ficando no forward" << std::endl;
+		release();
+		return false;
+	}
+	return true;
+}
+
+void DeferredRenderer::release()
+{
+	if (framebuffer != 0)
+		glState.deleteFramebuffer(framebuffer);
+	for (GLuint* texture : { &albedoTexture, &normalTexture, &depthTexture })
+	{
+		if (*texture != 0)
+			glState.deleteTexture(*texture);
+		*texture = 0;
+	}
+	if (emptyVao != 0)
+		glDevice.deleteVertexArray(emptyVao);
+	framebuffer = emptyVao = 0;
+}
+
+void DeferredRenderer::beginGeometry()
+{
+	glState.bindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+	glState.depthMask(true);
+	// Alfa 0 e profundidade 1 marcam os pixels onde nada foi desenhado
+	glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+}
+
+void DeferredRenderer::resolve(Shader* lightingShader, const glm::mat4& viewProjection, const std::function<void(Shader*)>& setupShader)
+{
+	PROFILE_ZONE("DeferredRenderer::resolve");
+	glState.bindFramebuffer(GL_FRAMEBUFFER, glState.screenFramebuffer());
+
+	// Sem o shader de luz (no compilou) a tela fica s com o fundo, mas a profundidade ainda vai
+	if (lightingShader)
+	{
+		// Um tringulo por pixel da tela, sem teste de profundidade
+		glState.enable(GL_DEPTH_TEST, false);
+		lightingShader->Use();
+		setupShader(lightingShader);
+		glm::mat4 inverseViewProjection = glm::inverse(viewProjection);
+		lightingShader->setMat4("inverseViewProjection", glm::value_ptr(inverseViewProjection));
+		int x, y, viewportWidth, viewportHeight;
+		glState.getViewport(x, y, viewportWidth, viewportHeight);
+		lightingShader->setVec4("viewport", (float)x, (float)y, (float)viewportWidth, (float)viewportHeight);
+		glState.bindTexture(TEXTURE_UNIT, GL_TEXTURE_2D, albedoTexture);
+		glState.bindTexture(TEXTURE_UNIT + 1, GL_TEXTURE_2D, normalTexture);
+		glState.bindTexture(TEXTURE_UNIT + 2, GL_TEXTURE_2D, depthTexture);
+		lightingShader->setInt("gAlbedo", TEXTURE_UNIT);
+		lightingShader->setInt("gNormal", TEXTURE_UNIT + 1);
+		lightingShader->setInt("gDepth", TEXTURE_UNIT + 2);
+		glState.bindVertexArray(emptyVao);
+		glDrawArrays(GL_TRIANGLES, 0, 3);
+		PROFILE_DRAW(1);
+	}
+	glState.enable(GL_DEPTH_TEST, true);
+
+	// Profundidade do G-buffer na tela, para os transparentes (forward) serem escondidos pelos opacos
+	glState.bindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+	glBlitFramebuffer(0, 0, width, height, 0, 0, width, height, GL_DEPTH_BUFFER_BIT, GL_NEAREST);
+	glState.bindFramebuffer(GL_READ_FRAMEBUFFER, glState.screenFramebuffer());
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <functional>
+
+//GLAD
+#include <glad/glad.h>
+
+//GLM
+#include <glm/glm.hpp>
+
+#include "Shader.h"
+
+// Caminho deferred, alternativo ao forward. Os opacos so desenhados uma vez
+// no G-buffer (variante GBUFFER do uber-shader) e a luz  calculada depois,
+// num tringulo de tela cheia (shaders/deferred.fs), s para os pixels que
+// sobraram visveis: o overdraw custa s o preenchimento do G-buffer, no a
+// iluminao. O passo de luz usa a mesma conta do forward (phong.glsl) e, com
+// a variante CLUSTERED, as mesmas luzes em clusters.
+//
+// G-buffer compacto, 12 bytes por pixel:
+//   cor 0: RGBA8   cor base e shininess / 256 (alfa 0 = material sem luz)
+//   cor 1: RG16F   normal de mundo em octaedro
+//   profundidade: DEPTH24_STENCIL8, de onde sai a posio (no h alvo de posio)
+// Os transparentes continuam forward: resolve() copia a profundidade do
+// G-buffer para a tela antes deles.
+class DeferredRenderer
+{
+public:
+	// Unidades de textura do G-buffer no passo de luz (cor, normal, profundidade)
+	static const int TEXTURE_UNIT = 1;
+
+	DeferredRenderer();
+	~DeferredRenderer();
+
+	// Cria o G-buffer do tamanho da tela; false se o framebuffer ficar incompleto
+	bool init(int width, int height);
+	void release();
+	bool ready() const { return framebuffer != 0; }
+
+	// Liga e limpa o G-buffer (os desenhos seguintes vo para ele)
+	void beginGeometry();
+	// Volta para a tela e ilumina. 'setupShader' manda os uniforms do quadro (view, luz...)
+	// para o programa de luz, como na troca de programa da RenderQueue.
+	void resolve(Shader* lightingShader, const glm::mat4& viewProjection, const std::function<void(Shader*)>& setupShader);
+
+	int bytesPerPixel() const { return 12; }
+
+protected:
+	int width, height;
+	GLuint framebuffer;
+	GLuint albedoTexture, normalTexture, depthTexture;
+	GLuint emptyVao; //O perfil core no desenha sem VAO, mesmo sem atributos
+};
@@ -0,0 +1,117 @@
+#include "DynamicResolution.h"
+
+#include <iostream>
+#include <cmath>
+#include <algorithm>
+
+#include "GLState.h"
+#include "Profiler.h"
+
+// Peso de cada medio nova na mdia mvel
+static const float SMOOTHING = 0.25f;
+// Frao do alvo mirada de fato, para sobrar folga para os picos
+static const double HEADROOM = 0.9;
+
+static float clampScale(float scale)
+{
+	return scale < DynamicResolution::MIN_SCALE ? DynamicResolution::MIN_SCALE : scale > DynamicResolution::MAX_SCALE ? DynamicResolution::MAX_SCALE : scale;
+}
+
+DynamicResolution::DynamicResolution() : output(0), width(0), height(0), targetMs(16.6), currentScale(1.0f), smoothedScale(1.0f), changed(false), gpuTime(GL_TIMESTAMP)
+{
+}
+
+DynamicResolution::~DynamicResolution()
+{
+	release();
+}
+
+bool DynamicResolution::init(int width, int height, double targetMs)
+{
+	release();
+	if (!target.init(width, height))
+		return false;
+	this->width = width;
+	this->height = height;
+	this->targetMs = targetMs;
+	output = glState.screenFramebuffer();
+	currentScale = smoothedScale = MAX_SCALE;
+	changed = false;
+	stats = DynamicResolutionStats();
+	std::cout << "Resolucao dinamica: alvo de " << targetMs << " ms de GPU, escala entre " << MIN_SCALE << " e " << MAX_SCALE << std::endl;
+	return true;
+}
+
+void DynamicResolution::release()
+{
+	if (ready())
+		glState.setScreenFramebuffer(output);
+	target.release();
+	gpuTime.release();
+}
+
+int DynamicResolution::renderWidth() const
+{
+	return std::max(1, (int)std::lround(width * currentScale));
+}
+
+int DynamicResolution::renderHeight() const
+{
+	return std::max(1, (int)std::lround(height * currentScale));
+}
+
+void DynamicResolution::beginFrame()
+{
+	if (!ready())
+		return;
+	changed = false;
+	// A tag de cada medio  a escala (em milsimos) com que aquele quadro foi desenhado;
+	// todas as medies prontas entram na mdia, a deciso de trocar a escala  uma s
+	bool measured = false;
+	while (gpuTime.poll())
+	{
+		stats.gpuMs = gpuTime.milliseconds();
+		float measuredScale = gpuTime.resultTag() / 1000.0f;
+		if (stats.gpuMs > 0.0)
+		{
+			float wanted = clampScale(measuredScale * (float)std::sqrt(targetMs * HEADROOM / stats.gpuMs));
+			smoothedScale += (wanted - smoothedScale) * SMOOTHING;
+		}
+		measured = true;
+	}
+	if (measured)
+	{
+		if (std::fabs(smoothedScale - currentScale) > SCALE_STEP * 0.75f)
+		{
+			currentScale = clampScale(std::round(smoothedScale / SCALE_STEP) * SCALE_STEP);
+			changed = true;
+			stats.changes++;
+		}
+	}
+	stats.frames++;
+	stats.scaleSum += currentScale;
+	if (currentScale < stats.minScale)
+		stats.minScale = currentScale;
+
+	gpuTime.begin((GLuint64)std::lround(currentScale * 1000.0f));
+	glState.setScreenFramebuffer(target.target());
+	glState.bindFramebuffer(GL_FRAMEBUFFER, target.target());
+	glState.viewport(0, 0, renderWidth(), renderHeight());
+}
+
+void DynamicResolution::endFrame()
+{
+	if (!ready())
+		return;
+	PROFILE_ZONE("DynamicResolution::upscale");
+	// Na escala 1  s uma cpia
+	glState.bindFramebuffer(GL_READ_FRAMEBUFFER, target.target());
+	glState.bindFramebuffer(GL_DRAW_FRAMEBUFFER, output);
+	glBlitFramebuffer(0, 0, renderWidth(), renderHeight(), 0, 0, width, height, GL_COLOR_BUFFER_BIT,
+		currentScale < MAX_SCALE ? GL_LINEAR : GL_NEAREST);
+	gpuTime.end();
+
+	glState.setScreenFramebuffer(output);
+	glState.bindFramebuffer(GL_FRAMEBUFFER, output);
+	glState.viewport(0, 0, width, height);
+}
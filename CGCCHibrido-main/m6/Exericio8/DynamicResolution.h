@@ -0,0 +1,70 @@
+#pragma once
+
+//GLAD
+#include <glad/glad.h>
+
+#include "GpuQuery.h"
+#include "OffscreenTarget.h"
+
+// Contagens da DynamicResolution desde o init()
+struct DynamicResolutionStats
+{
+	int frames = 0;
+	int changes = 0; //Vezes que a escala mudou
+	double scaleSum = 0.0; //Para a mdia
+	float minScale = 1.0f;
+	double gpuMs = 0.0; //ltima medio
+};
+
+// Resoluo dinmica: a cena  desenhada num alvo do tamanho da tela, mas s
+// num retngulo de scale() x o tamanho (a viewport), e endFrame() amplia esse
+// retngulo para a tela com filtro bilinear (glBlitFramebuffer com GL_LINEAR).
+// O alvo nunca  realocado, ento mudar a escala no custa nada. Enquanto
+// isso o alvo faz o papel da tela (glState.setScreenFramebuffer), ento o
+// deferred, as sombras etc. voltam para ele sem saber de nada.
+//
+// O controle l o tempo de GPU do quadro inteiro (GpuQuery com GL_TIMESTAMP,
+// resultados de alguns quadros atrs, marcados com a escala usada) e, como o
+// custo cresce com os pixels, pede a escala escala * sqrt(alvo / tempo). A
+// mdia mvel dessas escalas  arredondada a passos de SCALE_STEP e s muda
+// quando se afasta mais de 3/4 de passo da atual, para no ficar oscilando.
+class DynamicResolution
+{
+public:
+	static constexpr float MIN_SCALE = 0.5f;
+	static constexpr float MAX_SCALE = 1.0f;
+	static constexpr float SCALE_STEP = 0.05f;
+
+	DynamicResolution();
+	~DynamicResolution();
+
+	// 'targetMs'  o tempo de GPU a manter por quadro. Precisa do contexto; o
+	// framebuffer que faz o papel da tela nesse momento  para onde vai a imagem ampliada.
+	bool init(int width, int height, double targetMs);
+	void release();
+	bool ready() const { return target.ready(); }
+
+	// Ajusta a escala com as medies que chegaram e passa a desenhar no alvo
+	void beginFrame();
+	// Amplia para a tela e volta para ela (framebuffer e viewport)
+	void endFrame();
+
+	float scale() const { return currentScale; }
+	int renderWidth() const;
+	int renderHeight() const;
+	// Se o ltimo beginFrame() mudou a escala (quem depende do tamanho em pixels refaz o que precisar)
+	bool scaleChanged() const { return changed; }
+
+	const DynamicResolutionStats& totalStats() const { return stats; }
+
+protected:
+	OffscreenTarget target;
+	GLuint output; //Framebuffer da tela de verdade
+	int width, height;
+	double targetMs;
+	float currentScale;
+	float smoothedScale; //Mdia mvel das escalas pedidas pelas medies
+	bool changed;
+	GpuQuery gpuTime;
+	DynamicResolutionStats stats;
+};
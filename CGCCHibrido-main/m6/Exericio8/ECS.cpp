@@ -0,0 +1,49 @@
+#include "ECS.h"
+
+#include <atomic>
+#include <iostream>
+
+int nextComponentId()
+{
+	static std::atomic<int> next(0);
+	int id = next++;
+	if (id >= MAX_COMPONENT_TYPES)
+		std::cout << "ERROR::ECS::Mais de " << MAX_COMPONENT_TYPES << " tipos de componente" << std::endl;
+	return id;
+}
+
+Entity Registry::create()
+{
+	uint32_t index;
+	if (!freeIndices.empty())
+	{
+		index = freeIndices.back();
+		freeIndices.pop_back();
+	}
+	else
+	{
+		index = (uint32_t)generations.size();
+		generations.push_back(0);
+	}
+	living++;
+	return (generations[index] << ENTITY_INDEX_BITS) | index;
+}
+
+void Registry::destroy(Entity entity)
+{
+	if (!alive(entity))
+		return;
+	for (std::unique_ptr<ComponentPoolBase>& pool : pools)
+		if (pool)
+			pool->remove(entity);
+	uint32_t index = entityIndex(entity);
+	generations[index] = (generations[index] + 1) & 0xFF;
+	freeIndices.push_back(index);
+	living--;
+}
+
+bool Registry::alive(Entity entity) const
+{
+	uint32_t index = entityIndex(entity);
+	return entity != ENTITY_NONE && index < generations.size() && generations[index] == entityGeneration(entity);
+}
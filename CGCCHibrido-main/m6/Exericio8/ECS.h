@@ -0,0 +1,176 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+#include "JobSystem.h"
+
+// Entidade = ndice nos 24 bits baixos + gerao nos 8 altos. A gerao muda
+// quando o ndice  reaproveitado, ento um Entity guardado de uma entidade j
+// destruda no acerta a nova que ocupou o lugar.
+typedef uint32_t Entity;
+#define ENTITY_NONE 0xFFFFFFFFu
+#define ENTITY_INDEX_BITS 24
+#define ENTITY_INDEX_MASK ((1u << ENTITY_INDEX_BITS) - 1)
+
+inline uint32_t entityIndex(Entity entity) { return entity & ENTITY_INDEX_MASK; }
+inline uint32_t entityGeneration(Entity entity) { return entity >> ENTITY_INDEX_BITS; }
+
+// Um bit por tipo de componente (mscaras de leitura/escrita do SystemScheduler)
+typedef uint32_t ComponentMask;
+#define MAX_COMPONENT_TYPES 32
+
+// Nmero sequencial dado a cada tipo de componente no primeiro uso
+int nextComponentId();
+template<typename T>
+int componentId()
+{
+	static const int id = nextComponentId();
+	return id;
+}
+template<typename... T>
+ComponentMask componentMask()
+{
+	return (ComponentMask(0) | ... | (ComponentMask(1) << componentId<T>()));
+}
+
+// Parte do conjunto esparso que no depende do tipo do componente
+class ComponentPoolBase
+{
+public:
+	virtual ~ComponentPoolBase() {}
+	virtual void remove(Entity entity) = 0;
+
+	bool has(Entity entity) const
+	{
+		uint32_t index = entityIndex(entity);
+		return index < sparse.size() && sparse[index] != ENTITY_NONE && dense[sparse[index]] == entity;
+	}
+	int size() const { return (int)dense.size(); }
+	// Entidade dona de cada posio do vetor de componentes
+	const Entity* entities() const { return dense.data(); }
+
+protected:
+	std::vector<uint32_t> sparse; //ndice da entidade -> posio em dense (ENTITY_NONE se no tem)
+	std::vector<Entity> dense;
+};
+
+// Conjunto esparso de um tipo de componente: os componentes ficam contguos,
+// sem buracos, e a remoo troca o removido com o ltimo
+template<typename T>
+class ComponentPool : public ComponentPoolBase
+{
+public:
+	T& add(Entity entity, const T& value)
+	{
+		uint32_t index = entityIndex(entity);
+		if (index >= sparse.size())
+			sparse.resize(index + 1, ENTITY_NONE);
+		if (sparse[index] != ENTITY_NONE && dense[sparse[index]] == entity)
+			return data[sparse[index]] = value;
+		sparse[index] = (uint32_t)dense.size();
+		dense.push_back(entity);
+		data.push_back(value);
+		return data.back();
+	}
+
+	void remove(Entity entity) override
+	{
+		if (!has(entity))
+			return;
+		uint32_t slot = sparse[entityIndex(entity)];
+		uint32_t last = (uint32_t)dense.size() - 1;
+		if (slot != last)
+		{
+			dense[slot] = dense[last];
+			data[slot] = std::move(data[last]);
+			sparse[entityIndex(dense[slot])] = slot;
+		}
+		dense.pop_back();
+		data.pop_back();
+		sparse[entityIndex(entity)] = ENTITY_NONE;
+	}
+
+	T* get(Entity entity) { return has(entity) ? &data[sparse[entityIndex(entity)]] : nullptr; }
+	T& at(int slot) { return data[slot]; }
+	T* components() { return data.data(); }
+
+protected:
+	std::vector<T> data;
+};
+
+// Registro de entidades e componentes. Componentes so structs simples, cada
+// tipo no seu ComponentPool; os sistemas percorrem o vetor contguo do primeiro
+// tipo pedido e procuram os outros pelo conjunto esparso.
+class Registry
+{
+public:
+	Registry() : living(0) {}
+
+	Entity create();
+	// Tira todos os componentes e libera o ndice
+	void destroy(Entity entity);
+	bool alive(Entity entity) const;
+	int size() const { return living; }
+
+	template<typename T>
+	T& add(Entity entity, const T& value = T()) { return pool<T>().add(entity, value); }
+	template<typename T>
+	void remove(Entity entity) { pool<T>().remove(entity); }
+	template<typename T>
+	T* get(Entity entity) { return pool<T>().get(entity); }
+	template<typename T>
+	bool has(Entity entity) { return pool<T>().has(entity); }
+
+	template<typename T>
+	ComponentPool<T>& pool()
+	{
+		int id = componentId<T>();
+		if (id >= (int)pools.size())
+			pools.resize(id + 1);
+		if (!pools[id])
+			pools[id].reset(new ComponentPool<T>());
+		return *static_cast<ComponentPool<T>*>(pools[id].get());
+	}
+
+	// f(entity, First&, Rest&...) para cada entidade que tem todos os componentes.
+	// Percorre o vetor de First: ele deve ser o tipo mais raro da lista.
+	template<typename First, typename... Rest, typename F>
+	void each(F f)
+	{
+		eachRange<First, Rest...>(0, pool<First>().size(), f);
+	}
+
+	// Como each(), com o vetor de First dividido entre as threads do jobSystem.
+	// f  chamada em paralelo e s pode mexer nos componentes que recebe.
+	template<typename First, typename... Rest, typename F>
+	void eachParallel(int grain, F f)
+	{
+		// Cria os pools antes, para nenhuma thread mexer em 'pools'
+		(pool<Rest>(), ...);
+		jobSystem.parallelFor(pool<First>().size(), grain, [&](int begin, int end) {
+			eachRange<First, Rest...>(begin, end, f);
+		});
+	}
+
+	// each() s nas posies [begin, end) do vetor de First (um bloco de um lao paralelo)
+	template<typename First, typename... Rest, typename F>
+	void eachRange(int begin, int end, F& f)
+	{
+		ComponentPool<First>& first = pool<First>();
+		const Entity* entities = first.entities();
+		for (int i = begin; i < end; i++)
+		{
+			Entity entity = entities[i];
+			if ((pool<Rest>().has(entity) && ...))
+				f(entity, first.at(i), *pool<Rest>().get(entity)...);
+		}
+	}
+
+protected:
+	std::vector<std::unique_ptr<ComponentPoolBase>> pools; //Por componentId
+	std::vector<uint32_t> generations; //Gerao atual de cada ndice
+	std::vector<uint32_t> freeIndices;
+	int living;
+};
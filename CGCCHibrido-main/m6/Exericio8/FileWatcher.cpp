@@ -0,0 +1,143 @@
+#include "FileWatcher.h"
+
+#include <chrono>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+#include "ShaderPreprocessor.h"
+
+static std::filesystem::file_time_type lastWriteTime(const std::string& path)
+{
+	std::error_code error;
+	std::filesystem::file_time_type time = std::filesystem::last_write_time(path, error);
+	return error ? std::filesystem::file_time_type() : time;
+}
+
+void FileWatcher::watch(const std::string& path)
+{
+	std::string file = ShaderPreprocessor::normalize(path);
+	std::string directory = std::filesystem::path(file).parent_path().generic_string();
+	if (directory.empty())
+		directory = ".";
+
+	std::lock_guard<std::mutex> lock(mutex);
+	if (files.count(file))
+		return;
+	files[file] = lastWriteTime(file);
+	if (directories.insert(directory).second)
+	{
+#ifdef __linux__
+		if (inotifyFd >= 0)
+		{
+			int wd = inotify_add_watch(inotifyFd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+			if (wd >= 0)
+				watchDirectories[wd] = directory;
+		}
+#endif
+	}
+}
+
+void FileWatcher::start(Callback callback)
+{
+	if (running)
+		return;
+	this->callback = callback;
+#ifdef __linux__
+	inotifyFd = inotify_init1(IN_NONBLOCK);
+	if (inotifyFd >= 0)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		for (const std::string& directory : directories)
+		{
+			int wd = inotify_add_watch(inotifyFd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+			if (wd >= 0)
+				watchDirectories[wd] = directory;
+		}
+	}
+#endif
+	running = true;
+	thread = std::thread(&FileWatcher::run, this);
+}
+
+void FileWatcher::stop()
+{
+	if (!running)
+		return;
+	running = false;
+	thread.join();
+#ifdef __linux__
+	if (inotifyFd >= 0)
+		close(inotifyFd);
+	inotifyFd = -1;
+	watchDirectories.clear();
+#endif
+}
+
+std::vector<std::string> FileWatcher::pollTimestamps()
+{
+	std::vector<std::string> changed;
+	std::lock_guard<std::mutex> lock(mutex);
+	for (auto& file : files)
+	{
+		std::filesystem::file_time_type time = lastWriteTime(file.first);
+		if (time != file.second)
+		{
+			file.second = time;
+			changed.push_back(file.first);
+		}
+	}
+	return changed;
+}
+
+void FileWatcher::run()
+{
+	while (running)
+	{
+#ifdef __linux__
+		if (inotifyFd >= 0)
+		{
+			pollfd descriptor = { inotifyFd, POLLIN, 0 };
+			if (poll(&descriptor, 1, 100) <= 0)
+				continue;
+
+			// Editores costumam gerar vrios eventos por gravao: junta tudo que chegar em seguida
+			std::this_thread::sleep_for(std::chrono::milliseconds(20));
+			std::set<std::string> changed;
+			alignas(inotify_event) char buffer[4096];
+			ssize_t length;
+			while ((length = read(inotifyFd, buffer, sizeof(buffer))) > 0)
+			{
+				for (char* ptr = buffer; ptr < buffer + length;)
+				{
+					inotify_event* event = (inotify_event*)ptr;
+					ptr += sizeof(inotify_event) + event->len;
+					if (event->len == 0)
+						continue;
+					std::lock_guard<std::mutex> lock(mutex);
+					auto directory = watchDirectories.find(event->wd);
+					if (directory == watchDirectories.end())
+						continue;
+					std::string file = ShaderPreprocessor::normalize(directory->second + "/" + event->name);
+					auto watched = files.find(file);
+					if (watched != files.end())
+					{
+						watched->second = lastWriteTime(file);
+						changed.insert(file);
+					}
+				}
+			}
+			if (!changed.empty())
+				callback(std::vector<std::string>(changed.begin(), changed.end()));
+			continue;
+		}
+#endif
+		std::this_thread::sleep_for(std::chrono::milliseconds(250));
+		std::vector<std::string> changed = pollTimestamps();
+		if (!changed.empty())
+			callback(changed);
+	}
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <functional>
+#include <filesystem>
+
+// Observa arquivos numa thread separada e avisa quando algum muda.
+// No Linux usa inotify nos diretrios dos arquivos; nas outras plataformas
+// compara a data de modificao periodicamente.
+class FileWatcher
+{
+public:
+	// Recebe, na thread do watcher, os arquivos alterados de uma vez
+	typedef std::function<void(const std::vector<std::string>&)> Callback;
+
+	FileWatcher() : running(false) {}
+	~FileWatcher() { stop(); }
+
+	// Pode ser chamado com o watcher rodando
+	void watch(const std::string& path);
+	void start(Callback callback);
+	void stop();
+
+protected:
+	void run();
+	std::vector<std::string> pollTimestamps();
+
+	Callback callback;
+	std::thread thread;
+	std::atomic<bool> running;
+	std::mutex mutex;
+	std::map<std::string, std::filesystem::file_time_type> files;
+	std::set<std::string> directories;
+#ifdef __linux__
+	int inotifyFd = -1;
+	std::map<int, std::string> watchDirectories;
+#endif
+};
@@ -0,0 +1,141 @@
+#include "FrameBenchmark.h"
+
+#include <sstream>
+#include <algorithm>
+#include <cmath>
+
+FrameBenchmark::FrameBenchmark() : current(0)
+{
+}
+
+FrameBenchmark::~FrameBenchmark()
+{
+	release();
+}
+
+void FrameBenchmark::start(int frames)
+{
+	release();
+	timings.assign(WARMUP_FRAMES + frames, FrameTiming());
+	queries.resize(timings.size());
+	glGenQueries((GLsizei)queries.size(), queries.data());
+	current = 0;
+}
+
+void FrameBenchmark::beginFrame()
+{
+	if (done())
+		return;
+	frameStart = Clock::now();
+	glBeginQuery(GL_TIME_ELAPSED, queries[current]);
+}
+
+void FrameBenchmark::submitted()
+{
+	if (done())
+		return;
+	glEndQuery(GL_TIME_ELAPSED);
+	timings[current].cpuMs = std::chrono::duration<double, std::milli>(Clock::now() - frameStart).count();
+}
+
+void FrameBenchmark::endFrame()
+{
+	if (done())
+		return;
+	timings[current].frameMs = std::chrono::duration<double, std::milli>(Clock::now() - frameStart).count();
+	current++;
+}
+
+void FrameBenchmark::finish()
+{
+	glFinish();
+	for (int i = 0; i < current; i++)
+	{
+		GLuint64 elapsed = 0;
+		glGetQueryObjectui64v(queries[i], GL_QUERY_RESULT, &elapsed);
+		timings[i].gpuMs = elapsed / 1000000.0;
+	}
+}
+
+void FrameBenchmark::release()
+{
+	if (!queries.empty())
+		glDeleteQueries((GLsizei)queries.size(), queries.data());
+	queries.clear();
+}
+
+TimingSummary FrameBenchmark::summarize(std::vector<double> values)
+{
+	TimingSummary summary;
+	if (values.empty())
+		return summary;
+	std::sort(values.begin(), values.end());
+	// Percentil pelo posto mais prximo: o menor valor com pelo menos p% da srie at ele
+	auto percentile = [&](double p) {
+		size_t rank = (size_t)std::max(1.0, std::ceil(p / 100.0 * values.size()));
+		return values[std::min(rank, values.size()) - 1];
+	};
+	double sum = 0.0;
+	for (double value : values)
+		sum += value;
+	summary.mean = sum / values.size();
+	summary.p50 = percentile(50.0);
+	summary.p95 = percentile(95.0);
+	summary.p99 = percentile(99.0);
+	summary.max = values.back();
+	return summary;
+}
+
+static void writeSummary(std::ostringstream& json, const char* name, const TimingSummary& summary)
+{
+	json << "  \"" << name << "\": { \"mean\": " << summary.mean << ", \"p50\": " << summary.p50 << ", \"p95\": " << summary.p95
+		<< ", \"p99\": " << summary.p99 << ", \"max\": " << summary.max << " }";
+}
+
+// Aspas e barras escapadas para caber numa string JSON
+static std::string jsonString(const std::string& text)
+{
+	std::string escaped = "\"";
+	for (char c : text)
+	{
+		if (c == '"' || c == '\\')
+			escaped += '\\';
+		escaped += c;
+	}
+	return escaped + "\"";
+}
+
+std::string FrameBenchmark::report(const std::string& scene, const std::string& path) const
+{
+	std::vector<double> frame, cpu, gpu;
+	int gpuBound = 0;
+	for (int i = WARMUP_FRAMES; i < current; i++)
+	{
+		frame.push_back(timings[i].frameMs);
+		cpu.push_back(timings[i].cpuMs);
+		gpu.push_back(timings[i].gpuMs);
+		if (timings[i].gpuMs > timings[i].cpuMs)
+			gpuBound++;
+	}
+	const char* renderer = (const char*)glGetString(GL_RENDERER);
+	const char* version = (const char*)glGetString(GL_VERSION);
+
+	std::ostringstream json;
+	json << "{\n";
+	json << "  \"scene\": " << jsonString(scene) << ",\n";
+	json << "  \"path\": " << jsonString(path) << ",\n";
+	json << "  \"renderer\": " << jsonString(renderer ? renderer : "") << ",\n";
+	json << "  \"gl_version\": " << jsonString(version ? version : "") << ",\n";
+	json << "  \"frames\": " << frame.size() << ",\n";
+	json << "  \"warmup_frames\": " << std::min(current, (int)WARMUP_FRAMES) << ",\n";
+	writeSummary(json, "frame_ms", summarize(frame));
+	json << ",\n";
+	writeSummary(json, "cpu_ms", summarize(cpu));
+	json << ",\n";
+	writeSummary(json, "gpu_ms", summarize(gpu));
+	json << ",\n";
+	// Quadros em que a GPU levou mais que a CPU para o mesmo trabalho
+	json << "  \"gpu_bound_fraction\": " << (frame.empty() ? 0.0 : (double)gpuBound / frame.size()) << "\n";
+	json << "}\n";
+	return json.str();
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <chrono>
+
+//GLAD
+#include <glad/glad.h>
+
+// Mdia e percentis de uma srie de tempos (ms)
+struct TimingSummary
+{
+	double mean = 0.0, p50 = 0.0, p95 = 0.0, p99 = 0.0, max = 0.0;
+};
+
+// Medio quadro a quadro do --benchmark. Cada quadro guarda trs tempos:
+// o do quadro inteiro (de um beginFrame() ao endFrame(), com a troca de
+// buffers), o de CPU (at submitted(), quando os comandos do quadro j foram
+// todos enviados) e o de GPU, uma GL_TIME_ELAPSED em volta dos mesmos comandos:
+// o tempo que a GPU passou executando o quadro, no o intervalo entre o incio
+// e o fim dele na linha do tempo da GPU. As outras medies de tempo que ficam
+// dentro dela (zonas do Profiler, resoluo dinmica) usam GL_TIMESTAMP, que
+// pode se aninhar. Os resultados da GPU s so lidos no finish(),
+// ento a medio no trava o pipeline. Os primeiros WARMUP_FRAMES quadros
+// (shaders sendo compilados, caches frios) ficam de fora do relatrio.
+class FrameBenchmark
+{
+public:
+	static const int WARMUP_FRAMES = 10;
+
+	FrameBenchmark();
+	~FrameBenchmark();
+
+	// Prepara 'frames' quadros medidos (mais os de aquecimento)
+	void start(int frames);
+	int totalFrames() const { return (int)timings.size(); }
+	bool done() const { return current >= (int)timings.size(); }
+
+	void beginFrame();
+	void submitted();
+	void endFrame();
+	// Espera a GPU terminar e l os tempos de GPU
+	void finish();
+	void release();
+
+	// Relatrio em JSON (mdia, p50, p95, p99 e mximo do quadro, da CPU e da GPU)
+	std::string report(const std::string& scene, const std::string& path) const;
+
+	static TimingSummary summarize(std::vector<double> values);
+
+protected:
+	typedef std::chrono::steady_clock Clock;
+
+	struct FrameTiming
+	{
+		double frameMs = 0.0, cpuMs = 0.0, gpuMs = 0.0;
+	};
+
+	std::vector<FrameTiming> timings;
+	std::vector<GLuint> queries; //Uma GL_TIME_ELAPSED por quadro
+	int current;
+	Clock::time_point frameStart;
+};
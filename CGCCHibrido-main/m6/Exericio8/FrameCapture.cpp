@@ -0,0 +1,430 @@
+#include "FrameCapture.h"
+
+#include <iostream>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <algorithm>
+
+#include "GLDevice.h"
+#include "GLState.h"
+#include "Profiler.h"
+
+// Extenso de 'path' em minsculas, sem o ponto
+static std::string extension(const std::string& path)
+{
+	size_t dot = path.find_last_of('.');
+	if (dot == std::string::npos || path.find_first_of("/\\", dot) != std::string::npos)
+		return "";
+	std::string ext = path.substr(dot + 1);
+	for (char& c : ext)
+		c = (char)tolower((unsigned char)c);
+	return ext;
+}
+
+FrameCapture::FrameCapture() : format(CAPTURE_PNG), width(0), height(0), fps(60), frameSize(0), persistent(false), blocking(false), next(0), frameNumber(0), quit(false)
+{
+}
+
+FrameCapture::~FrameCapture()
+{
+	stop();
+}
+
+bool FrameCapture::start(const std::string& path, int width, int height, int fps)
+{
+	stop();
+	std::string ext = extension(path);
+	if (ext == "png")
+		format = CAPTURE_PNG;
+	else if (ext == "y4m")
+		format = CAPTURE_Y4M;
+	else if (ext == "raw" || ext == "rgb")
+		format = CAPTURE_RAW;
+	else
+	{
+		std::cout << "Formato de captura desconhecido: " << path << " (use .png, .y4m ou .raw)" << std::endl;
+		return false;
+	}
+	this->path = path;
+	this->width = width;
+	this->height = height;
+	this->fps = fps;
+	frameSize = (GLsizeiptr)width * height * 4;
+
+	if (format != CAPTURE_PNG)
+	{
+		stream.open(path.c_str(), std::ios::binary);
+		if (!stream)
+		{
+			std::cout << "Nao foi possivel gravar " << path << std::endl;
+			return false;
+		}
+		if (format == CAPTURE_Y4M)
+		{
+			// 4:2:0 precisa de largura e altura pares; seno vai sem subamostragem
+			bool subsampled = (width % 2 == 0 && height % 2 == 0);
+			stream << "YUV4MPEG2 W" << width << " H" << height << " F" << fps << ":1 Ip A1:1 " << (subsampled ? "C420jpeg" : "C444") << "\n";
+		}
+	}
+
+	// Com buffer storage os buffers ficam mapeados do incio ao fim
+	persistent = glDevice.bufferStorage();
+	GLbitfield flags = GL_MAP_READ_BIT | (persistent ? GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT : 0);
+	buffers.resize(PBO_COUNT);
+	for (Slot& slot : buffers)
+	{
+		slot.buffer = glDevice.createBuffer(frameSize, nullptr, flags | (persistent ? GL_CLIENT_STORAGE_BIT : 0));
+		if (persistent)
+			slot.mapped = (unsigned char*)glDevice.mapBuffer(slot.buffer, 0, frameSize, flags);
+	}
+	next = 0;
+	frameNumber = 0;
+	stats = CaptureStats();
+	quit = false;
+	writer = std::thread(&FrameCapture::writerLoop, this);
+	std::cout << "Captura: " << width << " x " << height << " em " << path << " (" << PBO_COUNT << " PBOs, "
+		<< (persistent ? "mapeamento persistente" : "mapeados a cada quadro") << ")" << std::endl;
+	return true;
+}
+
+void FrameCapture::stop()
+{
+	if (!active())
+		return;
+	collect(true);
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		quit = true;
+	}
+	wake.notify_one();
+	writer.join();
+	recycle();
+	for (Slot& slot : buffers)
+	{
+		if (slot.mapped)
+			glDevice.unmapBuffer(slot.buffer);
+		glDeleteBuffers(1, &slot.buffer);
+	}
+	buffers.clear();
+	if (stream.is_open())
+		stream.close();
+}
+
+void FrameCapture::capture(GLuint framebuffer)
+{
+	if (!active())
+		return;
+	PROFILE_ZONE("FrameCapture");
+	auto start = std::chrono::high_resolution_clock::now();
+	recycle();
+	collect(false);
+
+	Slot& slot = buffers[next];
+	if (slot.state != SLOT_FREE && blocking)
+	{
+		// Espera a GPU e depois a gravao devolverem o buffer mais antigo
+		auto waitStart = std::chrono::high_resolution_clock::now();
+		collect(true);
+		while (slot.state != SLOT_FREE)
+		{
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				finished.wait(lock, [this] { return !done.empty(); });
+			}
+			recycle();
+		}
+		stats.waits++;
+		stats.waitMs += std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - waitStart).count();
+	}
+	if (slot.state != SLOT_FREE)
+	{
+		// O buffer mais antigo ainda est com a GPU ou com a gravao: melhor perder
+		// o quadro da captura do que segurar o desenho
+		stats.dropped++;
+		stats.captureMs += std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+		return;
+	}
+
+	// S pede a cpia: com um PBO ligado em GL_PIXEL_PACK_BUFFER o ltimo argumento  um deslocamento nele
+	glState.bindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+	glState.bindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+	glPixelStorei(GL_PACK_ALIGNMENT, 4);
+	glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+	glState.bindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+	slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	slot.state = SLOT_READING;
+	slot.frame = ++frameNumber;
+	next = (next + 1) % PBO_COUNT;
+	stats.captured++;
+	stats.captureMs += std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+}
+
+void FrameCapture::collect(bool wait)
+{
+	// A partir de 'next' os buffers esto do quadro mais antigo para o mais novo
+	for (int i = 0; i < PBO_COUNT; i++)
+	{
+		int index = (next + i) % PBO_COUNT;
+		Slot& slot = buffers[index];
+		if (slot.state != SLOT_READING)
+			continue;
+		GLenum result = glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+		if (result == GL_TIMEOUT_EXPIRED && !wait)
+			break;
+		while (result == GL_TIMEOUT_EXPIRED)
+			result = glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+		glDeleteSync(slot.fence);
+		slot.fence = 0;
+		if (!persistent)
+			slot.mapped = (unsigned char*)glDevice.mapBuffer(slot.buffer, 0, frameSize, GL_MAP_READ_BIT);
+		slot.state = SLOT_WRITING;
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			pending.push_back(index);
+		}
+		wake.notify_one();
+	}
+}
+
+void FrameCapture::recycle()
+{
+	std::vector<int> returned;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		returned.swap(done);
+	}
+	for (int index : returned)
+	{
+		Slot& slot = buffers[index];
+		if (!persistent)
+		{
+			glDevice.unmapBuffer(slot.buffer);
+			slot.mapped = nullptr;
+		}
+		slot.state = SLOT_FREE;
+	}
+}
+
+CaptureStats FrameCapture::totalStats() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return stats;
+}
+
+void FrameCapture::writerLoop()
+{
+	std::unique_lock<std::mutex> lock(mutex);
+	for (;;)
+	{
+		wake.wait(lock, [this] { return quit || !pending.empty(); });
+		if (pending.empty())
+			break;
+		int index = pending.front();
+		pending.pop_front();
+		// S a thread do GL mexe no estado do buffer; aqui s se l a memria mapeada
+		const unsigned char* pixels = buffers[index].mapped;
+		long long frame = buffers[index].frame;
+		lock.unlock();
+		auto start = std::chrono::high_resolution_clock::now();
+		if (pixels)
+			writeFrame(pixels, frame);
+		double writeMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+		lock.lock();
+		stats.written++;
+		stats.writeMs += writeMs;
+		done.push_back(index);
+		finished.notify_one();
+	}
+}
+
+void FrameCapture::writeFrame(const unsigned char* pixels, long long frame)
+{
+	if (format == CAPTURE_PNG)
+	{
+		char number[32];
+		snprintf(number, sizeof(number), "_%06lld", frame);
+		writePNG(path.substr(0, path.size() - 4) + number + ".png", pixels);
+	}
+	else if (format == CAPTURE_Y4M)
+		writeY4M(pixels);
+	else
+	{
+		// RGB de cima para baixo (a OpenGL l de baixo para cima)
+		scratch.resize((size_t)width * 3);
+		for (int y = height - 1; y >= 0; y--)
+		{
+			const unsigned char* row = pixels + (size_t)y * width * 4;
+			for (int x = 0; x < width; x++)
+				memcpy(&scratch[(size_t)x * 3], row + (size_t)x * 4, 3);
+			stream.write((const char*)scratch.data(), (std::streamsize)scratch.size());
+		}
+	}
+}
+
+static uint32_t crc32(uint32_t crc, const unsigned char* data, size_t size)
+{
+	static uint32_t table[256];
+	static bool ready = false;
+	if (!ready)
+	{
+		for (uint32_t n = 0; n < 256; n++)
+		{
+			uint32_t c = n;
+			for (int k = 0; k < 8; k++)
+				c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+			table[n] = c;
+		}
+		ready = true;
+	}
+	crc = ~crc;
+	for (size_t i = 0; i < size; i++)
+		crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+	return ~crc;
+}
+
+static void putBigEndian(std::vector<unsigned char>& out, uint32_t value)
+{
+	out.push_back((unsigned char)(value >> 24));
+	out.push_back((unsigned char)(value >> 16));
+	out.push_back((unsigned char)(value >> 8));
+	out.push_back((unsigned char)value);
+}
+
+static void writeChunk(std::ofstream& file, const char* type, const std::vector<unsigned char>& data)
+{
+	std::vector<unsigned char> header;
+	putBigEndian(header, (uint32_t)data.size());
+	header.insert(header.end(), type, type + 4);
+	uint32_t crc = crc32(crc32(0, header.data() + 4, 4), data.data(), data.size());
+	std::vector<unsigned char> trailer;
+	putBigEndian(trailer, crc);
+	file.write((const char*)header.data(), header.size());
+	file.write((const char*)data.data(), (std::streamsize)data.size());
+	file.write((const char*)trailer.data(), trailer.size());
+}
+
+// PNG RGB de 8 bits com o deflate em blocos armazenados (sem compresso): a
+// gravao fica presa ao disco, no  CPU, e no precisa de zlib
+void FrameCapture::writePNG(const std::string& path, const unsigned char* pixels)
+{
+	std::ofstream file(path.c_str(), std::ios::binary);
+	if (!file)
+	{
+		std::cout << "Nao foi possivel gravar " << path << std::endl;
+		return;
+	}
+	static const unsigned char signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+	file.write((const char*)signature, sizeof(signature));
+
+	std::vector<unsigned char> ihdr;
+	putBigEndian(ihdr, (uint32_t)width);
+	putBigEndian(ihdr, (uint32_t)height);
+	unsigned char rest[5] = { 8, 2, 0, 0, 0 }; //8 bits, RGB, deflate, filtros padro, sem entrelaamento
+	ihdr.insert(ihdr.end(), rest, rest + 5);
+	writeChunk(file, "IHDR", ihdr);
+
+	// Linhas com o byte de filtro (0 = nenhum), de cima para baixo
+	size_t rowSize = (size_t)width * 3 + 1;
+	scratch.resize(rowSize * height);
+	for (int y = 0; y < height; y++)
+	{
+		unsigned char* out = &scratch[rowSize * y];
+		const unsigned char* row = pixels + (size_t)(height - 1 - y) * width * 4;
+		*out++ = 0;
+		for (int x = 0; x < width; x++, out += 3)
+			memcpy(out, row + (size_t)x * 4, 3);
+	}
+
+	// zlib: cabealho, blocos armazenados de at 65535 bytes e Adler-32
+	std::vector<unsigned char> idat;
+	idat.reserve(scratch.size() + scratch.size() / 65535 * 5 + 16);
+	idat.push_back(0x78);
+	idat.push_back(0x01);
+	uint32_t a = 1, b = 0;
+	for (size_t offset = 0; offset < scratch.size();)
+	{
+		size_t size = std::min<size_t>(65535, scratch.size() - offset);
+		bool last = (offset + size == scratch.size());
+		idat.push_back(last ? 1 : 0);
+		idat.push_back((unsigned char)size);
+		idat.push_back((unsigned char)(size >> 8));
+		idat.push_back((unsigned char)~size);
+		idat.push_back((unsigned char)(~size >> 8));
+		idat.insert(idat.end(), scratch.begin() + offset, scratch.begin() + offset + size);
+		for (size_t i = offset; i < offset + size; i++)
+		{
+			a = (a + scratch[i]) % 65521;
+			b = (b + a) % 65521;
+		}
+		offset += size;
+	}
+	putBigEndian(idat, (b << 16) | a);
+	writeChunk(file, "IDAT", idat);
+	writeChunk(file, "IEND", std::vector<unsigned char>());
+}
+
+// YCbCr BT.601 de faixa completa (o "C420jpeg"), em ponto fixo de 16 bits
+static inline unsigned char lumaOf(int r, int g, int b)
+{
+	return (unsigned char)((19595 * r + 38470 * g + 7471 * b + 32768) >> 16);
+}
+
+// Com azul ou vermelho puro o arredondamento chega a 256
+static inline unsigned char chromaBlue(int r, int g, int b)
+{
+	return (unsigned char)std::min(255, (-11059 * r - 21709 * g + 32768 * b + (128 << 16) + 32768) >> 16);
+}
+
+static inline unsigned char chromaRed(int r, int g, int b)
+{
+	return (unsigned char)std::min(255, (32768 * r - 27439 * g - 5329 * b + (128 << 16) + 32768) >> 16);
+}
+
+void FrameCapture::writeY4M(const unsigned char* pixels)
+{
+	bool subsampled = (width % 2 == 0 && height % 2 == 0);
+	int chromaWidth = subsampled ? width / 2 : width, chromaHeight = subsampled ? height / 2 : height;
+	size_t lumaSize = (size_t)width * height, chromaSize = (size_t)chromaWidth * chromaHeight;
+	scratch.resize(lumaSize + 2 * chromaSize);
+	unsigned char* planeY = scratch.data();
+	unsigned char* planeU = planeY + lumaSize;
+	unsigned char* planeV = planeU + chromaSize;
+
+	// Linha y da imagem (de cima para baixo) no buffer lido de baixo para cima
+	auto row = [&](int y) { return pixels + (size_t)(height - 1 - y) * width * 4; };
+	for (int y = 0; y < height; y++)
+	{
+		const unsigned char* p = row(y);
+		for (int x = 0; x < width; x++, p += 4)
+			planeY[(size_t)y * width + x] = lumaOf(p[0], p[1], p[2]);
+	}
+	for (int y = 0; y < chromaHeight; y++)
+	{
+		for (int x = 0; x < chromaWidth; x++)
+		{
+			int r, g, b;
+			if (subsampled)
+			{
+				// Mdia dos 2x2 pixels do bloco
+				const unsigned char* p0 = row(2 * y) + (size_t)x * 8;
+				const unsigned char* p1 = row(2 * y + 1) + (size_t)x * 8;
+				r = (p0[0] + p0[4] + p1[0] + p1[4] + 2) >> 2;
+				g = (p0[1] + p0[5] + p1[1] + p1[5] + 2) >> 2;
+				b = (p0[2] + p0[6] + p1[2] + p1[6] + 2) >> 2;
+			}
+			else
+			{
+				const unsigned char* p = row(y) + (size_t)x * 4;
+				r = p[0];
+				g = p[1];
+				b = p[2];
+			}
+			planeU[(size_t)y * chromaWidth + x] = chromaBlue(r, g, b);
+			planeV[(size_t)y * chromaWidth + x] = chromaRed(r, g, b);
+		}
+	}
+	stream << "FRAME\n";
+	stream.write((const char*)scratch.data(), (std::streamsize)scratch.size());
+}
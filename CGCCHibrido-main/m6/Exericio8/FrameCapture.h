@@ -0,0 +1,116 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <fstream>
+
+//GLAD
+#include <glad/glad.h>
+
+// Formato dos quadros gravados
+enum CaptureFormat
+{
+	CAPTURE_PNG, //Um arquivo por quadro (nome_000001.png), sem compresso
+	CAPTURE_RAW, //Todos os quadros em sequncia num arquivo, RGB de 8 bits de cima para baixo
+	CAPTURE_Y4M //Vdeo YUV4MPEG2 (4:2:0, BT.601 de faixa completa) que o ffmpeg l direto
+};
+
+// Contagens do FrameCapture desde o start()
+struct CaptureStats
+{
+	long long captured = 0; //Quadros lidos da GPU
+	long long written = 0;
+	long long dropped = 0; //Descartados sem buffer livre (GPU ou gravao atrasada)
+	long long waits = 0; //Vezes que capture() esperou um buffer livre (com setBlocking)
+	double waitMs = 0.0;
+	double captureMs = 0.0; //CPU gasta em capture() na thread do GL
+	double writeMs = 0.0; //Na thread de gravao
+};
+
+// Gravao de quadros sem parar o pipeline. Um glReadPixels para a memria da
+// CPU espera a GPU terminar tudo o que foi pedido antes; aqui capture() s
+// pede a cpia da imagem para um pixel buffer object (a GPU faz quando chegar
+// l) e pe uma fence. H PBO_COUNT buffers em rodzio: um ou dois quadros
+// depois, quando a fence j passou, o buffer  mapeado e entregue  thread de
+// gravao, que converte e escreve direto da memria mapeada (sem cpia na
+// thread do GL) e devolve o buffer. Com buffer storage o mapeamento 
+// persistente; na 3.3 o buffer  mapeado e desmapeado a cada quadro.
+// Se a GPU ou a gravao no acompanham e o prximo buffer no est livre, o
+// quadro  descartado (e contado) em vez de segurar o desenho, a no ser com
+// setBlocking() (sem janela, onde o que importa  ter todos os quadros).
+class FrameCapture
+{
+public:
+	static const int PBO_COUNT = 4;
+
+	FrameCapture();
+	~FrameCapture();
+
+	// Formato pela extenso de 'path': .png (numerada por quadro), .y4m ou .raw/.rgb
+	bool start(const std::string& path, int width, int height, int fps = 60);
+	// Grava tudo o que est pendente e para a thread (precisa do contexto)
+	void stop();
+	bool active() const { return !buffers.empty(); }
+	// Espera um buffer livre em vez de descartar o quadro
+	void setBlocking(bool blocking) { this->blocking = blocking; }
+
+	// Pede a leitura de 'framebuffer' (depois de desenhar o quadro e antes da troca de buffers)
+	void capture(GLuint framebuffer);
+
+	CaptureFormat getFormat() const { return format; }
+	// Cpia feita com o mutex travado (a thread de gravao atualiza 'written' e 'writeMs')
+	CaptureStats totalStats() const;
+
+protected:
+	enum SlotState
+	{
+		SLOT_FREE,
+		SLOT_READING, //glReadPixels pedido, esperando a fence
+		SLOT_WRITING //Com a thread de gravao
+	};
+
+	struct Slot
+	{
+		GLuint buffer = 0;
+		GLsync fence = 0;
+		unsigned char* mapped = nullptr;
+		SlotState state = SLOT_FREE;
+		long long frame = 0;
+	};
+
+	// Entrega  gravao as leituras j terminadas, da mais antiga para a mais nova;
+	// com 'wait' espera cada fence em vez de parar na primeira pendente
+	void collect(bool wait);
+	// Desmapeia (sem buffer storage) e libera os buffers que a gravao devolveu
+	void recycle();
+	void writerLoop();
+	void writeFrame(const unsigned char* pixels, long long frame);
+	void writePNG(const std::string& path, const unsigned char* pixels);
+	void writeY4M(const unsigned char* pixels);
+
+	CaptureFormat format;
+	std::string path;
+	int width, height, fps;
+	GLsizeiptr frameSize;
+	bool persistent;
+	bool blocking;
+	std::vector<Slot> buffers;
+	int next; //Prximo buffer a receber um glReadPixels
+	long long frameNumber;
+
+	// Fila da thread de gravao (ndices de 'buffers') e os que ela j devolveu
+	std::thread writer;
+	mutable std::mutex mutex;
+	std::condition_variable wake, finished;
+	std::deque<int> pending;
+	std::vector<int> done;
+	bool quit;
+
+	std::ofstream stream; //RAW e Y4M
+	std::vector<unsigned char> scratch; //Converses da thread de gravao
+	CaptureStats stats;
+};
@@ -0,0 +1,80 @@
+#include "FrameScheduler.h"
+
+#include <thread>
+#include <algorithm>
+
+FrameScheduler::FrameScheduler(double step) : stepSeconds(step), frameInterval(Clock::duration::zero())
+{
+	reset();
+}
+
+void FrameScheduler::reset()
+{
+	accumulator = 0.0;
+	lastFrame = 0.0;
+	lastTime = Clock::now();
+	nextFrame = lastTime + frameInterval;
+}
+
+int FrameScheduler::beginFrame()
+{
+	return advance(measureFrame());
+}
+
+double FrameScheduler::measureFrame()
+{
+	Clock::time_point now = Clock::now();
+	double elapsed = std::chrono::duration<double>(now - lastTime).count();
+	lastTime = now;
+	return elapsed;
+}
+
+int FrameScheduler::advance(double elapsed)
+{
+	lastFrame = elapsed;
+	if (elapsed > MAX_FRAME_SECONDS)
+	{
+		stats.droppedSeconds += elapsed - MAX_FRAME_SECONDS;
+		elapsed = MAX_FRAME_SECONDS;
+	}
+	accumulator += elapsed;
+
+	int steps = (int)(accumulator / stepSeconds);
+	accumulator -= steps * stepSeconds;
+	if (steps > MAX_STEPS_PER_FRAME)
+	{
+		stats.droppedSeconds += (steps - MAX_STEPS_PER_FRAME) * stepSeconds;
+		steps = MAX_STEPS_PER_FRAME;
+	}
+
+	stats.frames++;
+	stats.steps += steps;
+	stats.maxStepsPerFrame = std::max(stats.maxStepsPerFrame, steps);
+	return steps;
+}
+
+void FrameScheduler::setFrameLimit(double fps)
+{
+	frameInterval = fps > 0.0 ? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / fps)) : Clock::duration::zero();
+	nextFrame = Clock::now() + frameInterval;
+}
+
+void FrameScheduler::waitForNextFrame()
+{
+	if (frameInterval == Clock::duration::zero())
+		return;
+	Clock::time_point start = Clock::now();
+	// O sleep do sistema pode acordar at alguns milissegundos depois: dorme at
+	// perto da hora e termina cedendo a vez
+	const Clock::duration margin = std::chrono::milliseconds(2);
+	if (nextFrame - start > margin)
+		std::this_thread::sleep_for(nextFrame - start - margin);
+	while (Clock::now() < nextFrame)
+		std::this_thread::yield();
+	Clock::time_point now = Clock::now();
+	stats.waitSeconds += std::chrono::duration<double>(now - start).count();
+	// Quadro atrasado: a prxima hora conta a partir de agora, sem tentar recuperar
+	nextFrame += frameInterval;
+	if (nextFrame < now)
+		nextFrame = now + frameInterval;
+}
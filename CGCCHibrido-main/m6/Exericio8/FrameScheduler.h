@@ -0,0 +1,67 @@
+#pragma once
+
+#include <chrono>
+
+// Contagens do FrameScheduler desde o incio
+struct FrameSchedulerStats
+{
+	long long frames = 0;
+	long long steps = 0; //Passos fixos da simulao
+	int maxStepsPerFrame = 0;
+	double droppedSeconds = 0.0; //Tempo descartado em quadros longos demais (a simulao ficou para trs)
+	double waitSeconds = 0.0; //Tempo esperando pelo limite de quadros
+};
+
+// Relgio do game loop. A simulao anda em passos fixos de step() segundos,
+// independente da taxa de quadros: beginFrame() soma o tempo real passado num
+// acumulador e diz quantos passos cabem nele, e o que sobra (alpha(), entre 0 e
+// 1)  quanto do prximo passo j passou. O desenho interpola entre os dois
+// ltimos estados da simulao com alpha(), ento o movimento  o mesmo a 30
+// ou a 500 quadros por segundo e sai suave mesmo quando o nmero de passos
+// varia de um quadro para o outro.
+//
+// Um quadro que demora demais (depurador, janela arrastada) no vira uma
+// rajada de passos: o tempo de um quadro  limitado a MAX_FRAME_SECONDS e os
+// passos a MAX_STEPS_PER_FRAME, e o excesso  descartado. Sem vsync,
+// setFrameLimit() segura o ritmo dos quadros em waitForNextFrame().
+class FrameScheduler
+{
+public:
+	static const int MAX_STEPS_PER_FRAME = 8;
+	static constexpr double MAX_FRAME_SECONDS = 0.25;
+
+	explicit FrameScheduler(double step = 1.0 / 120.0);
+
+	// Recomea a contagem (ex.: depois de carregar a cena), sem passos pendentes
+	void reset();
+	// Comea um quadro com o relgio; retorna quantos passos fixos a simulao deve dar
+	int beginFrame();
+	// S mede o tempo real desde o quadro anterior (para passar ao advance() depois)
+	double measureFrame();
+	// O mesmo com 'elapsed' segundos desde o quadro anterior (tempo fixo, para execues reproduzveis)
+	int advance(double elapsed);
+
+	double step() const { return stepSeconds; }
+	// Frao do prximo passo j acumulada, para interpolar o desenho
+	float alpha() const { return (float)(accumulator / stepSeconds); }
+	// Durao real do ltimo quadro
+	double frameSeconds() const { return lastFrame; }
+
+	// Quadros por segundo no mximo (0 = sem limite, s o swap interval da janela segura)
+	void setFrameLimit(double fps);
+	// Espera at a hora do prximo quadro com o limite ligado (chamar depois do swap)
+	void waitForNextFrame();
+
+	const FrameSchedulerStats& totalStats() const { return stats; }
+
+protected:
+	typedef std::chrono::steady_clock Clock;
+
+	double stepSeconds;
+	double accumulator;
+	double lastFrame;
+	Clock::time_point lastTime;
+	Clock::duration frameInterval; //Zero sem limite
+	Clock::time_point nextFrame;
+	FrameSchedulerStats stats;
+};
@@ -0,0 +1,253 @@
+#include "FrustumCuller.h"
+
+#include <atomic>
+#include <cmath>
+
+#include "JobSystem.h"
+#include "Profiler.h"
+
+// AVX quando o compilador gera AVX (/arch:AVX2 ou -mavx2); seno SSE, que todo x64 tem
+#if defined(__AVX__)
+#include <immintrin.h>
+#define CG_CULL_AVX 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CG_CULL_SSE 1
+#endif
+
+// Caixas por bloco do parallelFor (mltiplo de 8)
+static const int CULL_GRAIN = 4096;
+
+Frustum Frustum::fromMatrix(const glm::mat4& m)
+{
+	// Gribb/Hartmann: cada plano  a soma ou a diferena da ltima linha com uma das outras.
+	// A glm guarda por coluna, ento a linha i  (m[0][i], m[1][i], m[2][i], m[3][i]).
+	glm::vec4 row0(m[0][0], m[1][0], m[2][0], m[3][0]);
+	glm::vec4 row1(m[0][1], m[1][1], m[2][1], m[3][1]);
+	glm::vec4 row2(m[0][2], m[1][2], m[2][2], m[3][2]);
+	glm::vec4 row3(m[0][3], m[1][3], m[2][3], m[3][3]);
+
+	Frustum frustum;
+	frustum.planes[PLANE_LEFT] = row3 + row0;
+	frustum.planes[PLANE_RIGHT] = row3 - row0;
+	frustum.planes[PLANE_BOTTOM] = row3 + row1;
+	frustum.planes[PLANE_TOP] = row3 - row1;
+	frustum.planes[PLANE_NEAR] = row3 + row2;
+	frustum.planes[PLANE_FAR] = row3 - row2;
+	// Normais unitrias, para o teste da esfera comparar com o raio
+	for (glm::vec4& plane : frustum.planes)
+		plane /= glm::length(glm::vec3(plane));
+	return frustum;
+}
+
+bool Frustum::intersects(const AABB& box) const
+{
+	glm::vec3 c = box.center(), e = box.extents();
+	for (const glm::vec4& plane : planes)
+	{
+		// Distncia do centro mais o raio da caixa projetado na normal
+		float d = glm::dot(glm::vec3(plane), c) + plane.w + glm::dot(glm::abs(glm::vec3(plane)), e);
+		if (d < 0.0f)
+			return false;
+	}
+	return true;
+}
+
+Frustum::Containment Frustum::classify(const AABB& box) const
+{
+	glm::vec3 c = box.center(), e = box.extents();
+	Containment result = INSIDE;
+	for (const glm::vec4& plane : planes)
+	{
+		float d = glm::dot(glm::vec3(plane), c) + plane.w;
+		float r = glm::dot(glm::abs(glm::vec3(plane)), e);
+		if (d + r < 0.0f)
+			return OUTSIDE;
+		if (d - r < 0.0f)
+			result = INTERSECTING;
+	}
+	return result;
+}
+
+bool Frustum::intersects(const BoundingSphere& sphere) const
+{
+	for (const glm::vec4& plane : planes)
+		if (glm::dot(glm::vec3(plane), sphere.center) + plane.w < -sphere.radius)
+			return false;
+	return true;
+}
+
+int FrustumCuller::add(const AABB& worldBounds)
+{
+	int id = objects++;
+	// Cresce de 8 em 8; as sobras ficam como caixas vazias no infinito
+	int padded = (objects + 7) & ~7;
+	if ((int)centerX.size() < padded)
+	{
+		centerX.resize(padded, 1e30f);
+		centerY.resize(padded, 1e30f);
+		centerZ.resize(padded, 1e30f);
+		extentX.resize(padded, 0.0f);
+		extentY.resize(padded, 0.0f);
+		extentZ.resize(padded, 0.0f);
+		visibility.resize(padded, 0);
+	}
+	set(id, worldBounds);
+	return id;
+}
+
+void FrustumCuller::set(int id, const AABB& worldBounds)
+{
+	glm::vec3 c = worldBounds.center(), e = worldBounds.extents();
+	centerX[id] = c.x;
+	centerY[id] = c.y;
+	centerZ[id] = c.z;
+	extentX[id] = e.x;
+	extentY[id] = e.y;
+	extentZ[id] = e.z;
+}
+
+void FrustumCuller::clear()
+{
+	centerX.clear();
+	centerY.clear();
+	centerZ.clear();
+	extentX.clear();
+	extentY.clear();
+	extentZ.clear();
+	visibility.clear();
+	objects = 0;
+}
+
+const char* FrustumCuller::simdName()
+{
+#if defined(CG_CULL_AVX)
+	return "AVX";
+#elif defined(CG_CULL_SSE)
+	return "SSE";
+#else
+	return "escalar";
+#endif
+}
+
+int FrustumCuller::cull(const Frustum& frustum, Mode mode, bool threaded)
+{
+	PROFILE_ZONE("FrustumCuller::cull");
+	int padded = (int)centerX.size();
+	if (!threaded)
+		return mode == MODE_SIMD ? cullRangeSimd(frustum, 0, padded) : cullRangeScalar(frustum, 0, padded);
+
+	std::atomic<int> visibleCount(0);
+	jobSystem.parallelFor(padded, CULL_GRAIN, [&](int begin, int end) {
+		int n = mode == MODE_SIMD ? cullRangeSimd(frustum, begin, end) : cullRangeScalar(frustum, begin, end);
+		visibleCount += n;
+	});
+	return visibleCount;
+}
+
+int FrustumCuller::cullRangeScalar(const Frustum& frustum, int begin, int end)
+{
+	int visibleCount = 0;
+	for (int i = begin; i < end; i++)
+	{
+		bool inside = true;
+		for (const glm::vec4& plane : frustum.planes)
+		{
+			float d = plane.x * centerX[i] + plane.y * centerY[i] + plane.z * centerZ[i] + plane.w
+				+ std::fabs(plane.x) * extentX[i] + std::fabs(plane.y) * extentY[i] + std::fabs(plane.z) * extentZ[i];
+			if (d < 0.0f)
+			{
+				inside = false;
+				break;
+			}
+		}
+		visibility[i] = inside;
+		if (inside && i < objects)
+			visibleCount++;
+	}
+	return visibleCount;
+}
+
+int FrustumCuller::cullRangeSimd(const Frustum& frustum, int begin, int end)
+{
+#if defined(CG_CULL_AVX)
+	// Cada componente dos planos replicada nas 8 posies do registrador
+	__m256 px[Frustum::PLANE_COUNT], py[Frustum::PLANE_COUNT], pz[Frustum::PLANE_COUNT], pw[Frustum::PLANE_COUNT];
+	__m256 ax[Frustum::PLANE_COUNT], ay[Frustum::PLANE_COUNT], az[Frustum::PLANE_COUNT];
+	for (int p = 0; p < Frustum::PLANE_COUNT; p++)
+	{
+		const glm::vec4& plane = frustum.planes[p];
+		px[p] = _mm256_set1_ps(plane.x);
+		py[p] = _mm256_set1_ps(plane.y);
+		pz[p] = _mm256_set1_ps(plane.z);
+		pw[p] = _mm256_set1_ps(plane.w);
+		ax[p] = _mm256_set1_ps(std::fabs(plane.x));
+		ay[p] = _mm256_set1_ps(std::fabs(plane.y));
+		az[p] = _mm256_set1_ps(std::fabs(plane.z));
+	}
+	const __m256 zero = _mm256_setzero_ps();
+
+	int visibleCount = 0;
+	for (int i = begin; i < end; i += 8)
+	{
+		__m256 cx = _mm256_loadu_ps(&centerX[i]), cy = _mm256_loadu_ps(&centerY[i]), cz = _mm256_loadu_ps(&centerZ[i]);
+		__m256 ex = _mm256_loadu_ps(&extentX[i]), ey = _mm256_loadu_ps(&extentY[i]), ez = _mm256_loadu_ps(&extentZ[i]);
+		__m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+		for (int p = 0; p < Frustum::PLANE_COUNT; p++)
+		{
+			__m256 d = _mm256_add_ps(_mm256_mul_ps(px[p], cx), _mm256_mul_ps(py[p], cy));
+			d = _mm256_add_ps(d, _mm256_add_ps(_mm256_mul_ps(pz[p], cz), pw[p]));
+			__m256 r = _mm256_add_ps(_mm256_mul_ps(ax[p], ex), _mm256_add_ps(_mm256_mul_ps(ay[p], ey), _mm256_mul_ps(az[p], ez)));
+			inside = _mm256_and_ps(inside, _mm256_cmp_ps(_mm256_add_ps(d, r), zero, _CMP_GE_OQ));
+		}
+		int mask = _mm256_movemask_ps(inside);
+		for (int k = 0; k < 8; k++)
+		{
+			visibility[i + k] = (mask >> k) & 1;
+			if (((mask >> k) & 1) && i + k < objects)
+				visibleCount++;
+		}
+	}
+	return visibleCount;
+#elif defined(CG_CULL_SSE)
+	__m128 px[Frustum::PLANE_COUNT], py[Frustum::PLANE_COUNT], pz[Frustum::PLANE_COUNT], pw[Frustum::PLANE_COUNT];
+	__m128 ax[Frustum::PLANE_COUNT], ay[Frustum::PLANE_COUNT], az[Frustum::PLANE_COUNT];
+	for (int p = 0; p < Frustum::PLANE_COUNT; p++)
+	{
+		const glm::vec4& plane = frustum.planes[p];
+		px[p] = _mm_set1_ps(plane.x);
+		py[p] = _mm_set1_ps(plane.y);
+		pz[p] = _mm_set1_ps(plane.z);
+		pw[p] = _mm_set1_ps(plane.w);
+		ax[p] = _mm_set1_ps(std::fabs(plane.x));
+		ay[p] = _mm_set1_ps(std::fabs(plane.y));
+		az[p] = _mm_set1_ps(std::fabs(plane.z));
+	}
+	const __m128 zero = _mm_setzero_ps();
+
+	int visibleCount = 0;
+	for (int i = begin; i < end; i += 4)
+	{
+		__m128 cx = _mm_loadu_ps(&centerX[i]), cy = _mm_loadu_ps(&centerY[i]), cz = _mm_loadu_ps(&centerZ[i]);
+		__m128 ex = _mm_loadu_ps(&extentX[i]), ey = _mm_loadu_ps(&extentY[i]), ez = _mm_loadu_ps(&extentZ[i]);
+		__m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+		for (int p = 0; p < Frustum::PLANE_COUNT; p++)
+		{
+			__m128 d = _mm_add_ps(_mm_mul_ps(px[p], cx), _mm_mul_ps(py[p], cy));
+			d = _mm_add_ps(d, _mm_add_ps(_mm_mul_ps(pz[p], cz), pw[p]));
+			__m128 r = _mm_add_ps(_mm_mul_ps(ax[p], ex), _mm_add_ps(_mm_mul_ps(ay[p], ey), _mm_mul_ps(az[p], ez)));
+			inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(d, r), zero));
+		}
+		int mask = _mm_movemask_ps(inside);
+		for (int k = 0; k < 4; k++)
+		{
+			visibility[i + k] = (mask >> k) & 1;
+			if (((mask >> k) & 1) && i + k < objects)
+				visibleCount++;
+		}
+	}
+	return visibleCount;
+#else
+	return cullRangeScalar(frustum, begin, end);
+#endif
+}
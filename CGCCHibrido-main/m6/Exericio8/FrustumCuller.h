@@ -0,0 +1,64 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+//GLM
+#include <glm/glm.hpp>
+
+#include "Bounds.h"
+
+// Os seis planos do volume de viso, com a normal apontando para dentro
+// (ax + by + cz + d >= 0 do lado visvel)
+struct Frustum
+{
+	enum { PLANE_LEFT, PLANE_RIGHT, PLANE_BOTTOM, PLANE_TOP, PLANE_NEAR, PLANE_FAR, PLANE_COUNT };
+	glm::vec4 planes[PLANE_COUNT];
+
+	// Extrai os planos de projection * view (ex.: projection * camera.GetViewMatrix())
+	static Frustum fromMatrix(const glm::mat4& viewProjection);
+	bool intersects(const AABB& box) const;
+	// Posio da caixa em relao ao frustum: fora, cortando ou inteira dentro
+	enum Containment { OUTSIDE, INTERSECTING, INSIDE };
+	Containment classify(const AABB& box) const;
+	bool intersects(const BoundingSphere& sphere) const;
+};
+
+// Culling de muitas caixas contra o frustum. As caixas ficam em SoA (centro e
+// meia-extenso, um vetor por componente), e cada passo testa 8 caixas de uma
+// vez com AVX ou 4 com SSE, conforme o que o compilador tiver habilitado.
+// O lao  dividido entre as threads do jobSystem.
+class FrustumCuller
+{
+public:
+	enum Mode
+	{
+		MODE_SCALAR, //Uma caixa por vez (referncia para comparar)
+		MODE_SIMD //AVX (8 por vez) ou SSE (4 por vez)
+	};
+
+	// Adiciona uma caixa e devolve o id dela
+	int add(const AABB& worldBounds);
+	// Atualiza a caixa quando o objeto se move
+	void set(int id, const AABB& worldBounds);
+	void clear();
+	int size() const { return objects; }
+
+	// Testa todas as caixas; o resultado fica em visible(id). Retorna quantas so visveis.
+	int cull(const Frustum& frustum, Mode mode = MODE_SIMD, bool threaded = true);
+	bool visible(int id) const { return visibility[id] != 0; }
+
+	// Nome do caminho SIMD compilado ("AVX", "SSE" ou "escalar")
+	static const char* simdName();
+
+protected:
+	// Testam as caixas [begin, end) (mltiplos de 8) e retornam quantas das reais so visveis
+	int cullRangeScalar(const Frustum& frustum, int begin, int end);
+	int cullRangeSimd(const Frustum& frustum, int begin, int end);
+
+	// Centro e meia-extenso das caixas, com folga at o mltiplo de 8
+	std::vector<float> centerX, centerY, centerZ;
+	std::vector<float> extentX, extentY, extentZ;
+	std::vector<uint8_t> visibility;
+	int objects = 0;
+};
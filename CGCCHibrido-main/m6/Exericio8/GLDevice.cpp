@@ -0,0 +1,396 @@
+#include "GLDevice.h"
+
+#include <iostream>
+#include <algorithm>
+#include <vector>
+
+#include "GLState.h"
+
+GLDevice glDevice;
+
+GLDevice::GLDevice() : dsa(false), storage(false), multiDraw(false), parallelCompile(false), major(0), minor(0)
+{
+}
+
+void GLDevice::init(bool forceLegacy)
+{
+	major = GLVersion.major;
+	minor = GLVersion.minor;
+	dsa = !forceLegacy && (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access);
+	storage = !forceLegacy && (GLAD_GL_VERSION_4_4 || GLAD_GL_ARB_buffer_storage);
+	multiDraw = !forceLegacy && (GLAD_GL_VERSION_4_3 || GLAD_GL_ARB_multi_draw_indirect);
+	// No depende do caminho: com a extenso, quantas threads de compilao o driver quiser
+	parallelCompile = GLAD_GL_KHR_parallel_shader_compile || GLAD_GL_ARB_parallel_shader_compile;
+	if (GLAD_GL_KHR_parallel_shader_compile)
+		glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+	else if (GLAD_GL_ARB_parallel_shader_compile)
+		glMaxShaderCompilerThreadsARB(0xFFFFFFFF);
+	std::cout << "GLDevice: OpenGL " << major << "." << minor << ", caminho " << backendName()
+		<< (parallelCompile ? ", compilacao de shaders em paralelo" : "") << std::endl;
+}
+
+const char* GLDevice::glslVersion() const
+{
+	return atLeast(4, 5) ? "#version 450 core" : "#version 330 core";
+}
+
+const char* GLDevice::backendName() const
+{
+	return dsa ? "4.5 (direct state access)" : "3.3 (bind para editar)";
+}
+
+GLuint GLDevice::createBuffer(GLsizeiptr size, const void* data, GLbitfield flags)
+{
+	GLuint buffer;
+	GLenum usage = (flags & GL_MAP_READ_BIT) ? GL_STREAM_READ : (flags & GL_DYNAMIC_STORAGE_BIT) ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW;
+	if (dsa)
+	{
+		glCreateBuffers(1, &buffer);
+		// Buffer imutvel: o driver j sabe o tamanho e o uso definitivos
+		if (storage)
+			glNamedBufferStorage(buffer, size, data, flags);
+		else
+			glNamedBufferData(buffer, size, data, usage);
+		return buffer;
+	}
+
+	glGenBuffers(1, &buffer);
+	glState.bindBuffer(GL_ARRAY_BUFFER, buffer);
+	if (storage)
+		glBufferStorage(GL_ARRAY_BUFFER, size, data, flags);
+	else
+		glBufferData(GL_ARRAY_BUFFER, size, data, usage);
+	return buffer;
+}
+
+void GLDevice::updateBuffer(GLuint buffer, GLintptr offset, GLsizeiptr size, const void* data)
+{
+	if (dsa)
+	{
+		glNamedBufferSubData(buffer, offset, size, data);
+		return;
+	}
+	glState.bindBuffer(GL_ARRAY_BUFFER, buffer);
+	glBufferSubData(GL_ARRAY_BUFFER, offset, size, data);
+}
+
+void GLDevice::orphanBuffer(GLuint buffer, GLsizeiptr size)
+{
+	// Com glBufferStorage o createBuffer fez um buffer imutvel: o glBufferData nele daria
+	// GL_INVALID_OPERATION. Ele s pode ser invalidado (4.3); sem isso fica como est
+	if (storage)
+	{
+		if (GLAD_GL_VERSION_4_3)
+			glInvalidateBufferData(buffer);
+		return;
+	}
+	if (dsa)
+	{
+		glNamedBufferData(buffer, size, NULL, GL_DYNAMIC_DRAW);
+		return;
+	}
+	glState.bindBuffer(GL_ARRAY_BUFFER, buffer);
+	glBufferData(GL_ARRAY_BUFFER, size, NULL, GL_DYNAMIC_DRAW);
+}
+
+void GLDevice::copyBuffer(GLuint source, GLuint destination, GLintptr sourceOffset, GLintptr destinationOffset, GLsizeiptr size)
+{
+	if (dsa)
+	{
+		glCopyNamedBufferSubData(source, destination, sourceOffset, destinationOffset, size);
+		return;
+	}
+	glState.bindBuffer(GL_COPY_READ_BUFFER, source);
+	glState.bindBuffer(GL_COPY_WRITE_BUFFER, destination);
+	glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, sourceOffset, destinationOffset, size);
+}
+
+void* GLDevice::mapBuffer(GLuint buffer, GLintptr offset, GLsizeiptr size, GLbitfield access)
+{
+	if (dsa)
+		return glMapNamedBufferRange(buffer, offset, size, access);
+	glState.bindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+	return glMapBufferRange(GL_COPY_WRITE_BUFFER, offset, size, access);
+}
+
+void GLDevice::flushMappedBuffer(GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+	if (dsa)
+	{
+		glFlushMappedNamedBufferRange(buffer, offset, size);
+		return;
+	}
+	glState.bindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+	glFlushMappedBufferRange(GL_COPY_WRITE_BUFFER, offset, size);
+}
+
+void GLDevice::unmapBuffer(GLuint buffer)
+{
+	if (dsa)
+	{
+		glUnmapNamedBuffer(buffer);
+		return;
+	}
+	glState.bindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+	glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+}
+
+GLuint GLDevice::createVertexArray(const std::vector<VertexAttribute>& attributes)
+{
+	GLuint vao;
+	if (dsa)
+	{
+		glCreateVertexArrays(1, &vao);
+		for (const VertexAttribute& attribute : attributes)
+		{
+			glEnableVertexArrayAttrib(vao, attribute.location);
+			if (attribute.integer)
+				glVertexArrayAttribIFormat(vao, attribute.location, attribute.size, attribute.type, attribute.offset);
+			else
+				glVertexArrayAttribFormat(vao, attribute.location, attribute.size, attribute.type, attribute.normalized, attribute.offset);
+			glVertexArrayAttribBinding(vao, attribute.location, attribute.binding);
+		}
+		return vao;
+	}
+
+	// Na 3.3 o formato s pode ser passado junto com o buffer (glVertexAttribPointer),
+	// ento fica guardado at o vertexBuffer() do ponto de ligao
+	glGenVertexArrays(1, &vao);
+	layouts[vao] = attributes;
+	return vao;
+}
+
+void GLDevice::vertexBuffer(GLuint vao, GLuint binding, GLuint buffer, GLintptr offset, GLsizei stride, GLuint divisor)
+{
+	if (dsa)
+	{
+		glVertexArrayVertexBuffer(vao, binding, buffer, offset, stride);
+		glVertexArrayBindingDivisor(vao, binding, divisor);
+		return;
+	}
+
+	glState.bindVertexArray(vao);
+	glState.bindBuffer(GL_ARRAY_BUFFER, buffer);
+	for (const VertexAttribute& attribute : layouts[vao])
+	{
+		if (attribute.binding != binding)
+			continue;
+		if (attribute.integer)
+			glVertexAttribIPointer(attribute.location, attribute.size, attribute.type, stride, (GLvoid*)(offset + attribute.offset));
+		else
+			glVertexAttribPointer(attribute.location, attribute.size, attribute.type, attribute.normalized, stride, (GLvoid*)(offset + attribute.offset));
+		glEnableVertexAttribArray(attribute.location);
+		glVertexAttribDivisor(attribute.location, divisor);
+	}
+}
+
+void GLDevice::elementBuffer(GLuint vao, GLuint buffer)
+{
+	if (dsa)
+	{
+		glVertexArrayElementBuffer(vao, buffer);
+		return;
+	}
+	glState.bindVertexArray(vao);
+	glState.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer);
+}
+
+void GLDevice::deleteVertexArray(GLuint vao)
+{
+	layouts.erase(vao);
+	glState.deleteVertexArray(vao);
+}
+
+int GLDevice::mipLevels(int width, int height)
+{
+	int levels = 1;
+	for (int size = std::max(width, height); size > 1; size /= 2)
+		levels++;
+	return levels;
+}
+
+GLuint GLDevice::createTexture2D(GLenum internalFormat, int width, int height, int levels)
+{
+	if (levels <= 0)
+		levels = mipLevels(width, height);
+
+	GLuint texture;
+	if (dsa)
+	{
+		glCreateTextures(GL_TEXTURE_2D, 1, &texture);
+		glTextureStorage2D(texture, levels, internalFormat, width, height);
+		return texture;
+	}
+
+	// Na 3.3 cada nvel  alocado com glTexImage2D
+	GLenum format, type;
+	allocationFormat(internalFormat, format, type);
+	glGenTextures(1, &texture);
+	glState.bindTexture(0, GL_TEXTURE_2D, texture);
+	for (int level = 0; level < levels; level++)
+		glTexImage2D(GL_TEXTURE_2D, level, internalFormat, std::max(1, width >> level), std::max(1, height >> level), 0, format, type, NULL);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, levels - 1);
+	return texture;
+}
+
+GLuint GLDevice::createTexture2DArray(GLenum internalFormat, int width, int height, int layers)
+{
+	GLuint texture;
+	if (dsa)
+	{
+		glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &texture);
+		glTextureStorage3D(texture, 1, internalFormat, width, height, layers);
+		return texture;
+	}
+
+	GLenum format, type;
+	allocationFormat(internalFormat, format, type);
+	glGenTextures(1, &texture);
+	glState.bindTexture(0, GL_TEXTURE_2D_ARRAY, texture);
+	glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, internalFormat, width, height, layers, 0, format, type, NULL);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL, 0);
+	return texture;
+}
+
+void GLDevice::allocationFormat(GLenum internalFormat, GLenum& format, GLenum& type)
+{
+	// O formato dos dados no importa (no h dados), s precisa ser compatvel com o formato interno
+	format = GL_RGBA;
+	type = GL_UNSIGNED_BYTE;
+	switch (internalFormat)
+	{
+	case GL_DEPTH_COMPONENT16:
+	case GL_DEPTH_COMPONENT24:
+	case GL_DEPTH_COMPONENT32F:
+		format = GL_DEPTH_COMPONENT;
+		type = GL_FLOAT;
+		break;
+	case GL_DEPTH24_STENCIL8:
+		format = GL_DEPTH_STENCIL;
+		type = GL_UNSIGNED_INT_24_8;
+		break;
+	case GL_R32UI:
+	case GL_RG32UI:
+	case GL_RGBA32UI:
+		format = GL_RED_INTEGER;
+		type = GL_UNSIGNED_INT;
+		break;
+	}
+}
+
+void GLDevice::uploadTexture2D(GLuint texture, int width, int height, GLenum format, GLenum type, const void* data)
+{
+	// Linhas de 3 bytes (RGB) no so mltiplas de 4 em larguras mpares
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	if (dsa)
+		glTextureSubImage2D(texture, 0, 0, 0, width, height, format, type, data);
+	else
+	{
+		glState.bindTexture(0, GL_TEXTURE_2D, texture);
+		glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, format, type, data);
+	}
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+}
+
+void GLDevice::textureParameter(GLuint texture, GLenum name, GLint value, GLenum target)
+{
+	if (dsa)
+	{
+		glTextureParameteri(texture, name, value);
+		return;
+	}
+	glState.bindTexture(0, target, texture);
+	glTexParameteri(target, name, value);
+}
+
+void GLDevice::generateMipmap(GLuint texture)
+{
+	if (dsa)
+	{
+		glGenerateTextureMipmap(texture);
+		return;
+	}
+	glState.bindTexture(0, GL_TEXTURE_2D, texture);
+	glGenerateMipmap(GL_TEXTURE_2D);
+}
+
+GLuint GLDevice::createBufferTexture(GLenum internalFormat, GLuint buffer)
+{
+	GLuint texture;
+	if (dsa)
+	{
+		glCreateTextures(GL_TEXTURE_BUFFER, 1, &texture);
+		glTextureBuffer(texture, internalFormat, buffer);
+		return texture;
+	}
+	glGenTextures(1, &texture);
+	glState.bindTexture(0, GL_TEXTURE_BUFFER, texture);
+	glTexBuffer(GL_TEXTURE_BUFFER, internalFormat, buffer);
+	return texture;
+}
+
+GLuint GLDevice::createFramebuffer(const std::vector<GLuint>& colors, GLuint depth, GLenum depthAttachment, int layer)
+{
+	std::vector<GLenum> drawBuffers;
+	for (size_t i = 0; i < colors.size(); i++)
+		drawBuffers.push_back(GL_COLOR_ATTACHMENT0 + (GLenum)i);
+
+	GLuint framebuffer;
+	GLenum status;
+	if (dsa)
+	{
+		glCreateFramebuffers(1, &framebuffer);
+		auto attach = [&](GLenum attachment, GLuint texture) {
+			if (layer >= 0)
+				glNamedFramebufferTextureLayer(framebuffer, attachment, texture, 0, layer);
+			else
+				glNamedFramebufferTexture(framebuffer, attachment, texture, 0);
+		};
+		for (size_t i = 0; i < colors.size(); i++)
+			attach(drawBuffers[i], colors[i]);
+		if (depth != 0)
+			attach(depthAttachment, depth);
+		if (drawBuffers.empty())
+		{
+			// S profundidade (mapa de sombra)
+			glNamedFramebufferDrawBuffer(framebuffer, GL_NONE);
+			glNamedFramebufferReadBuffer(framebuffer, GL_NONE);
+		}
+		else
+			glNamedFramebufferDrawBuffers(framebuffer, (GLsizei)drawBuffers.size(), drawBuffers.data());
+		status = glCheckNamedFramebufferStatus(framebuffer, GL_DRAW_FRAMEBUFFER);
+	}
+	else
+	{
+		// Vinculado para leitura tambm, j que o glReadBuffer vale para o de leitura
+		glGenFramebuffers(1, &framebuffer);
+		glState.bindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+		auto attach = [&](GLenum attachment, GLuint texture) {
+			if (layer >= 0)
+				glFramebufferTextureLayer(GL_DRAW_FRAMEBUFFER, attachment, texture, 0, layer);
+			else
+				glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER, attachment, GL_TEXTURE_2D, texture, 0);
+		};
+		for (size_t i = 0; i < colors.size(); i++)
+			attach(drawBuffers[i], colors[i]);
+		if (depth != 0)
+			attach(depthAttachment, depth);
+		if (drawBuffers.empty())
+		{
+			glDrawBuffer(GL_NONE);
+			glReadBuffer(GL_NONE);
+		}
+		else
+			glDrawBuffers((GLsizei)drawBuffers.size(), drawBuffers.data());
+		status = glCheckFramebufferStatus(GL_DRAW_FRAMEBUFFER);
+		glState.bindFramebuffer(GL_FRAMEBUFFER, glState.screenFramebuffer());
+	}
+
+	if (status != GL_FRAMEBUFFER_COMPLETE)
+	{
+		std::cout << "ERROR::FRAMEBUFFER::INCOMPLETE 0x" << std::hex << status << std::dec << std::endl;
+		glState.deleteFramebuffer(framebuffer);
+		return 0;
+	}
+	return framebuffer;
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+//GLAD
+#include <glad/glad.h>
+
+#include <map>
+#include <vector>
+
+// Formato de um atributo de vrtice (o que vai para o glVertexArrayAttribFormat)
+struct VertexAttribute
+{
+	GLuint location;
+	GLint size;
+	GLenum type;
+	GLuint offset; //Relativo ao incio do vrtice
+	GLuint binding = 0; //Ponto de ligao do buffer de onde o atributo  lido
+	GLboolean normalized = GL_FALSE;
+	bool integer = false; //Chega no shader como int/uint em vez de float
+};
+
+// Criao e edio de buffers, VAOs e texturas. Com OpenGL 4.5 (ou a extenso
+// GL_ARB_direct_state_access) usa direct state access: os objetos so criados
+// e editados pelo nome, sem bind e sem mexer no que est vinculado. Sem isso
+// cai no caminho da 3.3, que vincula o objeto pelo GLState para edit-lo.
+// O caminho  escolhido em init(), depois do gladLoadGLLoader.
+class GLDevice
+{
+public:
+	GLDevice();
+
+	// Detecta o que o contexto atual oferece; forceLegacy usa o caminho da 3.3 mesmo com DSA disponvel
+	void init(bool forceLegacy = false);
+
+	bool directStateAccess() const { return dsa; }
+	bool bufferStorage() const { return storage; }
+	// glMultiDrawElementsIndirect (4.3); sem ele os comandos indiretos so desenhados um a um
+	bool multiDrawIndirect() const { return multiDraw; }
+	// GL_KHR/ARB_parallel_shader_compile: o driver compila e linka em threads prprias e
+	// GL_COMPLETION_STATUS_KHR diz, sem bloquear, se o programa j ficou pronto
+	bool parallelShaderCompile() const { return parallelCompile; }
+	int versionMajor() const { return major; }
+	int versionMinor() const { return minor; }
+	bool atLeast(int major, int minor) const { return this->major > major || (this->major == major && this->minor >= minor); }
+	// Diretiva #version que os shaders devem usar nesse contexto
+	const char* glslVersion() const;
+	const char* backendName() const;
+
+	// flags do glBufferStorage (GL_DYNAMIC_STORAGE_BIT, GL_MAP_WRITE_BIT...); na 3.3 viram s a dica de uso do glBufferData
+	// (GL_MAP_READ_BIT vira GL_STREAM_READ, para buffers de leitura da GPU)
+	GLuint createBuffer(GLsizeiptr size, const void* data, GLbitfield flags = 0);
+	// S funciona em buffers criados com GL_DYNAMIC_STORAGE_BIT
+	void updateBuffer(GLuint buffer, GLintptr offset, GLsizeiptr size, const void* data);
+	// Descarta o contedo (o driver troca o armazenamento em vez de esperar a GPU parar de us-lo).
+	// S para buffers do createBuffer: imutveis so invalidados (4.3), os outros realocados com glBufferData
+	void orphanBuffer(GLuint buffer, GLsizeiptr size);
+	// Cpia de buffer para buffer feita pela GPU (sem passar pela memria da CPU)
+	void copyBuffer(GLuint source, GLuint destination, GLintptr sourceOffset, GLintptr destinationOffset, GLsizeiptr size);
+	// glMapBufferRange; num buffer criado com GL_MAP_PERSISTENT_BIT o ponteiro vale at o buffer ser apagado
+	void* mapBuffer(GLuint buffer, GLintptr offset, GLsizeiptr size, GLbitfield access);
+	// Avisa o que foi escrito num mapeamento feito com GL_MAP_FLUSH_EXPLICIT_BIT
+	void flushMappedBuffer(GLuint buffer, GLintptr offset, GLsizeiptr size);
+	void unmapBuffer(GLuint buffer);
+
+	GLuint createVertexArray(const std::vector<VertexAttribute>& attributes);
+	// Liga um buffer a um ponto de ligao do VAO; divisor != 0 faz os atributos desse ponto avanarem por instncia
+	void vertexBuffer(GLuint vao, GLuint binding, GLuint buffer, GLintptr offset, GLsizei stride, GLuint divisor = 0);
+	void elementBuffer(GLuint vao, GLuint buffer);
+	void deleteVertexArray(GLuint vao);
+
+	// Textura 2D de tamanho fixo com 'levels' nveis de mipmap (0 = cadeia completa)
+	GLuint createTexture2D(GLenum internalFormat, int width, int height, int levels = 0);
+	void uploadTexture2D(GLuint texture, int width, int height, GLenum format, GLenum type, const void* data);
+	// Array de 'layers' texturas 2D de um nvel s (ex.: mapas de sombra)
+	GLuint createTexture2DArray(GLenum internalFormat, int width, int height, int layers);
+	// 'target' s  usado no caminho da 3.3, que precisa vincular a textura para edit-la
+	void textureParameter(GLuint texture, GLenum name, GLint value, GLenum target = GL_TEXTURE_2D);
+	void generateMipmap(GLuint texture);
+	// Textura de buffer (samplerBuffer no shader) lendo 'buffer' inteiro como 'internalFormat'
+	GLuint createBufferTexture(GLenum internalFormat, GLuint buffer);
+
+	// Framebuffer com as texturas em GL_COLOR_ATTACHMENT0.. (todas como draw buffers) e,
+	// se depth != 0, em 'depthAttachment'. Com layer >= 0 as texturas so arrays e s essa
+	// camada  ligada. Retorna 0 (e apaga o que criou) se ficar incompleto.
+	GLuint createFramebuffer(const std::vector<GLuint>& colors, GLuint depth = 0, GLenum depthAttachment = GL_DEPTH_ATTACHMENT, int layer = -1);
+
+protected:
+	static int mipLevels(int width, int height);
+	// Formato e tipo de dados aceitos pelo glTexImage* para alocar 'internalFormat' sem dados (caminho da 3.3)
+	static void allocationFormat(GLenum internalFormat, GLenum& format, GLenum& type);
+
+	bool dsa;
+	bool storage;
+	bool multiDraw;
+	bool parallelCompile;
+	int major, minor;
+	// Caminho da 3.3: formato dos atributos de cada VAO, aplicado quando chega o buffer do ponto de ligao
+	std::map<GLuint, std::vector<VertexAttribute>> layouts;
+};
+
+// Instncia nica usada por toda a aplicao (um contexto OpenGL)
+extern GLDevice glDevice;
@@ -0,0 +1,307 @@
+#include "GLState.h"
+
+GLState glState;
+
+GLState::GLState()
+{
+	frames = 0;
+	invalidate();
+}
+
+void GLState::invalidate()
+{
+	// ~0u nunca  um nome vlido, ento a prxima chamada sempre passa
+	program = ~0u;
+	vao = ~0u;
+	activeUnit = -1;
+	for (int i = 0; i < MAX_TEXTURE_UNITS; i++)
+		for (int t = 0; t < 4; t++)
+			textures[i][t] = ~0u;
+	for (int i = 0; i < MAX_BUFFER_TARGETS; i++)
+		buffers[i] = ~0u;
+	for (int t = 0; t < 2; t++)
+		for (int i = 0; i < MAX_INDEXED_BINDINGS; i++)
+			ranges[t][i] = { ~0u, -1, -1 };
+	drawFramebuffer = readFramebuffer = ~0u;
+	screen = 0;
+	depthTest = blend = cullFace = -1;
+	depthFn = GL_NONE;
+	depthWrite = -1;
+	colorWrite = -1;
+	blendSrc = blendDst = GL_NONE;
+	view[0] = view[1] = view[2] = view[3] = -1;
+}
+
+void GLState::beginFrame()
+{
+	lastFrame = current;
+	total.requested += current.requested;
+	total.issued += current.issued;
+	current = GLStateStats();
+	frames++;
+}
+
+bool GLState::track(bool changed)
+{
+	current.requested++;
+	if (changed)
+		current.issued++;
+	return changed;
+}
+
+void GLState::useProgram(GLuint program)
+{
+	if (track(this->program != program))
+	{
+		glUseProgram(program);
+		this->program = program;
+	}
+}
+
+void GLState::bindVertexArray(GLuint vao)
+{
+	if (track(this->vao != vao))
+	{
+		glBindVertexArray(vao);
+		this->vao = vao;
+		// O GL_ELEMENT_ARRAY_BUFFER faz parte do estado do VAO
+		buffers[bufferTargetIndex(GL_ELEMENT_ARRAY_BUFFER)] = ~0u;
+	}
+}
+
+void GLState::activeTexture(int unit)
+{
+	if (activeUnit != unit)
+	{
+		glActiveTexture(GL_TEXTURE0 + unit);
+		activeUnit = unit;
+	}
+}
+
+void GLState::bindTexture(int unit, GLenum target, GLuint texture)
+{
+	int t = textureTargetIndex(target);
+	if (unit >= MAX_TEXTURE_UNITS || t < 0)
+	{
+		track(true);
+		glActiveTexture(GL_TEXTURE0 + unit);
+		glBindTexture(target, texture);
+		activeUnit = -1;
+		return;
+	}
+	if (track(textures[unit][t] != texture))
+	{
+		activeTexture(unit);
+		glBindTexture(target, texture);
+		textures[unit][t] = texture;
+	}
+}
+
+void GLState::bindBuffer(GLenum target, GLuint buffer)
+{
+	int t = bufferTargetIndex(target);
+	if (t < 0)
+	{
+		track(true);
+		glBindBuffer(target, buffer);
+		return;
+	}
+	if (track(buffers[t] != buffer))
+	{
+		glBindBuffer(target, buffer);
+		buffers[t] = buffer;
+	}
+}
+
+void GLState::bindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+	int t = indexedTargetIndex(target);
+	if (t < 0 || index >= MAX_INDEXED_BINDINGS)
+	{
+		track(true);
+		glBindBufferRange(target, index, buffer, offset, size);
+	}
+	else
+	{
+		BufferRange& range = ranges[t][index];
+		if (!track(range.buffer != buffer || range.offset != offset || range.size != size))
+			return;
+		glBindBufferRange(target, index, buffer, offset, size);
+		range = { buffer, offset, size };
+	}
+	// Tambm vincula o buffer no ponto genrico do alvo
+	int generic = bufferTargetIndex(target);
+	if (generic >= 0)
+		buffers[generic] = buffer;
+}
+
+void GLState::bindFramebuffer(GLenum target, GLuint framebuffer)
+{
+	bool draw = (target == GL_FRAMEBUFFER || target == GL_DRAW_FRAMEBUFFER);
+	bool read = (target == GL_FRAMEBUFFER || target == GL_READ_FRAMEBUFFER);
+	bool changed = (draw && drawFramebuffer != framebuffer) || (read && readFramebuffer != framebuffer);
+	if (track(changed))
+	{
+		glBindFramebuffer(target, framebuffer);
+		if (draw)
+			drawFramebuffer = framebuffer;
+		if (read)
+			readFramebuffer = framebuffer;
+	}
+}
+
+void GLState::enable(GLenum cap, bool on)
+{
+	int* state = nullptr;
+	if (cap == GL_DEPTH_TEST)
+		state = &depthTest;
+	else if (cap == GL_BLEND)
+		state = &blend;
+	else if (cap == GL_CULL_FACE)
+		state = &cullFace;
+
+	if (track(state == nullptr || *state != (int)on))
+	{
+		if (on)
+			glEnable(cap);
+		else
+			glDisable(cap);
+		if (state)
+			*state = on;
+	}
+}
+
+void GLState::depthFunc(GLenum func)
+{
+	if (track(depthFn != func))
+	{
+		glDepthFunc(func);
+		depthFn = func;
+	}
+}
+
+void GLState::depthMask(bool write)
+{
+	if (track(depthWrite != (int)write))
+	{
+		glDepthMask(write ? GL_TRUE : GL_FALSE);
+		depthWrite = write;
+	}
+}
+
+void GLState::colorMask(bool write)
+{
+	if (track(colorWrite != (int)write))
+	{
+		GLboolean mask = write ? GL_TRUE : GL_FALSE;
+		glColorMask(mask, mask, mask, mask);
+		colorWrite = write;
+	}
+}
+
+void GLState::blendFunc(GLenum src, GLenum dst)
+{
+	if (track(blendSrc != src || blendDst != dst))
+	{
+		glBlendFunc(src, dst);
+		blendSrc = src;
+		blendDst = dst;
+	}
+}
+
+void GLState::viewport(int x, int y, int width, int height)
+{
+	if (track(view[0] != x || view[1] != y || view[2] != width || view[3] != height))
+	{
+		glViewport(x, y, width, height);
+		view[0] = x;
+		view[1] = y;
+		view[2] = width;
+		view[3] = height;
+	}
+}
+
+void GLState::deleteProgram(GLuint program)
+{
+	if (this->program == program)
+		this->program = ~0u;
+	glDeleteProgram(program);
+}
+
+void GLState::deleteVertexArray(GLuint vao)
+{
+	// Apagar o VAO vinculado faz a OpenGL voltar para o VAO 0
+	if (this->vao == vao)
+		this->vao = 0;
+	glDeleteVertexArrays(1, &vao);
+}
+
+void GLState::deleteBuffer(GLuint buffer)
+{
+	for (int i = 0; i < MAX_BUFFER_TARGETS; i++)
+		if (buffers[i] == buffer)
+			buffers[i] = 0;
+	for (int t = 0; t < 2; t++)
+		for (int i = 0; i < MAX_INDEXED_BINDINGS; i++)
+			if (ranges[t][i].buffer == buffer)
+				ranges[t][i] = { 0, 0, 0 };
+	glDeleteBuffers(1, &buffer);
+}
+
+void GLState::deleteTexture(GLuint texture)
+{
+	for (int i = 0; i < MAX_TEXTURE_UNITS; i++)
+		for (int t = 0; t < 4; t++)
+			if (textures[i][t] == texture)
+				textures[i][t] = 0;
+	glDeleteTextures(1, &texture);
+}
+
+void GLState::deleteFramebuffer(GLuint framebuffer)
+{
+	// Apagar o framebuffer vinculado volta para o padro (0)
+	if (drawFramebuffer == framebuffer)
+		drawFramebuffer = 0;
+	if (readFramebuffer == framebuffer)
+		readFramebuffer = 0;
+	glDeleteFramebuffers(1, &framebuffer);
+}
+
+int GLState::textureTargetIndex(GLenum target)
+{
+	switch (target)
+	{
+	case GL_TEXTURE_2D: return 0;
+	case GL_TEXTURE_2D_ARRAY: return 1;
+	case GL_TEXTURE_CUBE_MAP: return 2;
+	case GL_TEXTURE_BUFFER: return 3;
+	}
+	return -1;
+}
+
+int GLState::bufferTargetIndex(GLenum target)
+{
+	switch (target)
+	{
+	case GL_ARRAY_BUFFER: return 0;
+	case GL_ELEMENT_ARRAY_BUFFER: return 1;
+	case GL_UNIFORM_BUFFER: return 2;
+	case GL_PIXEL_PACK_BUFFER: return 3;
+	case GL_PIXEL_UNPACK_BUFFER: return 4;
+	case GL_COPY_READ_BUFFER: return 5;
+	case GL_COPY_WRITE_BUFFER: return 6;
+	case GL_TEXTURE_BUFFER: return 7;
+	case GL_DRAW_INDIRECT_BUFFER: return 8;
+	}
+	return -1;
+}
+
+int GLState::indexedTargetIndex(GLenum target)
+{
+	switch (target)
+	{
+	case GL_UNIFORM_BUFFER: return 0;
+	case GL_SHADER_STORAGE_BUFFER: return 1;
+	}
+	return -1;
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+//GLAD
+#include <glad/glad.h>
+
+// Contadores de troca de estado de um quadro
+struct GLStateStats
+{
+	int requested = 0; //Chamadas feitas ao GLState
+	int issued = 0; //Chamadas que chegaram de fato na OpenGL
+	int skipped() const { return requested - issued; }
+};
+
+// Cache do estado da OpenGL: guarda uma cpia do que est vinculado
+// (programa, VAO, texturas por unidade, buffers, blend/depth e viewport)
+// e descarta as chamadas que no mudariam nada. Todo o cdigo da engine
+// deve passar por aqui em vez de chamar glUseProgram/glBind* direto.
+class GLState
+{
+public:
+	static const int MAX_TEXTURE_UNITS = 16;
+	static const int MAX_BUFFER_TARGETS = 9;
+	// Pontos de ligao indexados guardados em cache (UBO e SSBO)
+	static const int MAX_INDEXED_BINDINGS = 8;
+
+	GLState();
+
+	// Esquece tudo o que est em cache (usar depois de cdigo que mexe na OpenGL por fora)
+	void invalidate();
+	// Fecha os contadores do quadro anterior e comea um novo
+	void beginFrame();
+
+	void useProgram(GLuint program);
+	void bindVertexArray(GLuint vao);
+	void bindTexture(int unit, GLenum target, GLuint texture);
+	void bindBuffer(GLenum target, GLuint buffer);
+	// glBindBufferRange de GL_UNIFORM_BUFFER ou GL_SHADER_STORAGE_BUFFER
+	void bindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
+	void bindFramebuffer(GLenum target, GLuint framebuffer);
+	// Framebuffer que faz o papel da tela (0, ou o alvo offscreen do modo sem janela);
+	// quem desenha em outro alvo volta para ele
+	void setScreenFramebuffer(GLuint framebuffer) { screen = framebuffer; }
+	GLuint screenFramebuffer() const { return screen; }
+
+	void enable(GLenum cap, bool on);
+	void depthFunc(GLenum func);
+	void depthMask(bool write);
+	// Liga ou desliga a escrita nos quatro canais de cor juntos
+	void colorMask(bool write);
+	void blendFunc(GLenum src, GLenum dst);
+	void viewport(int x, int y, int width, int height);
+
+	// Destroem o objeto e limpam qualquer referncia a ele no cache
+	void deleteProgram(GLuint program);
+	void deleteVertexArray(GLuint vao);
+	void deleteBuffer(GLuint buffer);
+	void deleteTexture(GLuint texture);
+	void deleteFramebuffer(GLuint framebuffer);
+
+	GLuint boundProgram() const { return program; }
+	// ltimo glViewport (para quem desenha em outro alvo e depois volta)
+	void getViewport(int& x, int& y, int& width, int& height) const { x = view[0]; y = view[1]; width = view[2]; height = view[3]; }
+	GLuint boundVertexArray() const { return vao; }
+
+	const GLStateStats& frameStats() const { return lastFrame; }
+	// Contadores do quadro em andamento
+	const GLStateStats& currentStats() const { return current; }
+	const GLStateStats& totalStats() const { return total; }
+	int frameCount() const { return frames; }
+
+protected:
+	// Conta o pedido e diz se ele precisa chegar na OpenGL
+	bool track(bool changed);
+	void activeTexture(int unit);
+	static int textureTargetIndex(GLenum target);
+	static int bufferTargetIndex(GLenum target);
+	static int indexedTargetIndex(GLenum target);
+
+	GLuint program;
+	GLuint vao;
+	int activeUnit;
+	GLuint textures[MAX_TEXTURE_UNITS][4];
+	GLuint buffers[MAX_BUFFER_TARGETS];
+	struct BufferRange
+	{
+		GLuint buffer;
+		GLintptr offset;
+		GLsizeiptr size;
+	};
+	BufferRange ranges[2][MAX_INDEXED_BINDINGS];
+	GLuint drawFramebuffer, readFramebuffer;
+	GLuint screen;
+
+	// Capacidades (-1 = desconhecido)
+	int depthTest, blend, cullFace;
+	GLenum depthFn;
+	int depthWrite;
+	int colorWrite;
+	GLenum blendSrc, blendDst;
+	int view[4];
+
+	GLStateStats current, lastFrame, total;
+	int frames;
+};
+
+// Instncia nica usada por toda a aplicao (um contexto OpenGL)
+extern GLState glState;
@@ -0,0 +1,187 @@
+#include "Geometry.h"
+
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <map>
+#include <tuple>
+#include <algorithm>
+#include <cstdlib>
+
+#include "GLDevice.h"
+#include "GLState.h"
+#include "Profiler.h"
+
+// Um campo de um vrtice de face ("" = ausente, index = -1). Os ndices do OBJ
+// comeam em 1 e os negativos contam a partir do ltimo elemento lido; retorna
+// false se o campo no  um nmero ou cai fora dos 'count' elementos.
+static bool parseFaceIndex(const std::string& field, int count, int& index)
+{
+	index = -1;
+	if (field.empty())
+		return true;
+	char* end = nullptr;
+	long value = strtol(field.c_str(), &end, 10);
+	if (*end != '\0' || value == 0)
+		return false;
+	index = value > 0 ? (int)value - 1 : count + (int)value;
+	return index >= 0 && index < count;
+}
+
+bool loadOBJ(const std::string& path, Geometry& geometry, glm::vec3 color)
+{
+	std::ifstream inputFile(path.c_str());
+	if (!inputFile.is_open())
+	{
+		std::cout << "Problema ao encontrar o arquivo " << path << std::endl;
+		return false;
+	}
+
+	std::vector<glm::vec3> positions;
+	std::vector<glm::vec2> texCoords;
+	std::vector<glm::vec3> normals;
+	// Trinca v/vt/vn -> ndice do vrtice j emitido
+	std::map<std::tuple<int, int, int>, GLuint> welded;
+
+	geometry.vertices.clear();
+	geometry.indices.clear();
+
+	std::string line;
+	int lineNumber = 0;
+	while (std::getline(inputFile, line))
+	{
+		lineNumber++;
+		std::istringstream ssline(line);
+		std::string word;
+		ssline >> word;
+
+		if (word == "v")
+		{
+			glm::vec3 v;
+			ssline >> v.x >> v.y >> v.z;
+			positions.push_back(v);
+		}
+		else if (word == "vt")
+		{
+			glm::vec2 vt;
+			ssline >> vt.s >> vt.t;
+			texCoords.push_back(vt);
+		}
+		else if (word == "vn")
+		{
+			glm::vec3 vn;
+			ssline >> vn.x >> vn.y >> vn.z;
+			normals.push_back(vn);
+		}
+		else if (word == "f")
+		{
+			for (int i = 0; i < 3; i++)
+			{
+				std::string token;
+				ssline >> token;
+
+				// v, v/vt, v//vn ou v/vt/vn: cada campo separado por '/'  lido sozinho
+				std::string fields[3];
+				size_t start = 0;
+				for (int f = 0; f < 3; f++)
+				{
+					size_t slash = token.find('/', start);
+					fields[f] = token.substr(start, slash == std::string::npos ? std::string::npos : slash - start);
+					if (slash == std::string::npos)
+						break;
+					start = slash + 1;
+				}
+				int v, vt, vn;
+				if (fields[0].empty() || !parseFaceIndex(fields[0], (int)positions.size(), v)
+					|| !parseFaceIndex(fields[1], (int)texCoords.size(), vt) || !parseFaceIndex(fields[2], (int)normals.size(), vn))
+				{
+					std::cout << "ERROR::OBJ::INDICE invalido '" << token << "' na linha " << lineNumber << " de " << path << std::endl;
+					geometry.vertices.clear();
+					geometry.indices.clear();
+					return false;
+				}
+				std::tuple<int, int, int> key(v, vt, vn);
+
+				auto it = welded.find(key);
+				if (it != welded.end())
+				{
+					geometry.indices.push_back(it->second);
+					continue;
+				}
+
+				GLuint index = (GLuint)geometry.vertexCount();
+				glm::vec3 p = positions[v];
+				glm::vec2 uv = (vt >= 0) ? texCoords[vt] : glm::vec2(0.0f);
+				glm::vec3 n = (vn >= 0) ? normals[vn] : glm::vec3(0.0f, 1.0f, 0.0f);
+				GLfloat vertex[Geometry::FLOATS_PER_VERTEX] = { p.x, p.y, p.z, color.r, color.g, color.b, uv.s, uv.t, n.x, n.y, n.z };
+				geometry.vertices.insert(geometry.vertices.end(), vertex, vertex + Geometry::FLOATS_PER_VERTEX);
+				geometry.indices.push_back(index);
+				welded[key] = index;
+			}
+		}
+	}
+	geometry.computeBounds();
+	return !geometry.indices.empty();
+}
+
+void Geometry::computeBounds()
+{
+	bounds = AABB();
+	for (size_t i = 0; i < vertices.size(); i += FLOATS_PER_VERTEX)
+		bounds.expand(glm::vec3(vertices[i], vertices[i + 1], vertices[i + 2]));
+
+	sphere.center = bounds.empty() ? glm::vec3(0.0f) : bounds.center();
+	sphere.radius = 0.0f;
+	for (size_t i = 0; i < vertices.size(); i += FLOATS_PER_VERTEX)
+		sphere.radius = std::max(sphere.radius, glm::length(glm::vec3(vertices[i], vertices[i + 1], vertices[i + 2]) - sphere.center));
+}
+
+GeometryBuffers uploadGeometry(const Geometry& geometry)
+{
+	GeometryBuffers buffers;
+	buffers.indexCount = geometry.indexCount();
+	buffers.vertexBuffer = glDevice.createBuffer(geometry.vertexBytes(), geometry.vertices.data());
+	buffers.indexBuffer = glDevice.createBuffer(geometry.indexBytes(), geometry.indices.data());
+	PROFILE_UPLOAD(geometry.vertexBytes() + geometry.indexBytes());
+
+	buffers.vao = glDevice.createVertexArray({
+		{ 0, 3, GL_FLOAT, 0 },
+		{ 1, 3, GL_FLOAT, 3 * sizeof(GLfloat) },
+		{ 2, 2, GL_FLOAT, 6 * sizeof(GLfloat) },
+		{ 3, 3, GL_FLOAT, 8 * sizeof(GLfloat) }
+	});
+	glDevice.vertexBuffer(buffers.vao, 0, buffers.vertexBuffer, 0, Geometry::FLOATS_PER_VERTEX * sizeof(GLfloat));
+	glDevice.elementBuffer(buffers.vao, buffers.indexBuffer);
+
+	// Posies compactadas: o pr-passo l 12 bytes por vrtice em vez de 44
+	std::vector<GLfloat> positions;
+	positions.reserve(geometry.vertexCount() * 3);
+	for (int i = 0; i < geometry.vertexCount(); i++)
+	{
+		const GLfloat* vertex = &geometry.vertices[i * Geometry::FLOATS_PER_VERTEX];
+		positions.insert(positions.end(), vertex, vertex + 3);
+	}
+	buffers.positionBuffer = glDevice.createBuffer(positions.size() * sizeof(GLfloat), positions.data());
+	PROFILE_UPLOAD(positions.size() * sizeof(GLfloat));
+	buffers.depthVao = glDevice.createVertexArray({ { 0, 3, GL_FLOAT, 0 } });
+	glDevice.vertexBuffer(buffers.depthVao, 0, buffers.positionBuffer, 0, 3 * sizeof(GLfloat));
+	glDevice.elementBuffer(buffers.depthVao, buffers.indexBuffer);
+	return buffers;
+}
+
+void GeometryBuffers::release()
+{
+	if (vao != 0)
+		glDevice.deleteVertexArray(vao);
+	if (vertexBuffer != 0)
+		glState.deleteBuffer(vertexBuffer);
+	if (indexBuffer != 0)
+		glState.deleteBuffer(indexBuffer);
+	if (depthVao != 0)
+		glDevice.deleteVertexArray(depthVao);
+	if (positionBuffer != 0)
+		glState.deleteBuffer(positionBuffer);
+	vao = vertexBuffer = indexBuffer = 0;
+	depthVao = positionBuffer = 0;
+	indexCount = 0;
+}
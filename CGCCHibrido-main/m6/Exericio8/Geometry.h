@@ -0,0 +1,57 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+//GLAD
+#include <glad/glad.h>
+
+//GLM
+#include <glm/glm.hpp>
+
+#include "Bounds.h"
+
+// Geometria indexada em memria, no formato de vrtice usado pelo uber-shader:
+// posio (3), cor (3), coordenada de textura (2) e normal (3), intercalados.
+struct Geometry
+{
+	static const int FLOATS_PER_VERTEX = 11;
+
+	std::vector<GLfloat> vertices;
+	std::vector<GLuint> indices;
+	// Limites no espao do objeto, calculados por computeBounds()
+	AABB bounds;
+	BoundingSphere sphere;
+
+	int vertexCount() const { return (int)vertices.size() / FLOATS_PER_VERTEX; }
+	int indexCount() const { return (int)indices.size(); }
+	int triangleCount() const { return (int)indices.size() / 3; }
+	GLsizeiptr vertexBytes() const { return vertices.size() * sizeof(GLfloat); }
+	GLsizeiptr indexBytes() const { return indices.size() * sizeof(GLuint); }
+
+	// Caixa a partir das posies; a esfera fica centrada na caixa, com o raio at o vrtice mais distante
+	void computeBounds();
+};
+
+// L um OBJ de tringulos com v/vt/vn. Cada combinao v/vt/vn diferente vira
+// um vrtice s, e as faces viram ndices para ele (o cubo cai de 36 para 24 vrtices).
+bool loadOBJ(const std::string& path, Geometry& geometry, glm::vec3 color = glm::vec3(1.0f));
+
+// Buffers e VAO de uma Geometry desenhada sem instncias (matriz no uniform model)
+struct GeometryBuffers
+{
+	GLuint vao = 0;
+	GLuint vertexBuffer = 0;
+	GLuint indexBuffer = 0;
+	int indexCount = 0;
+	// Fluxo s com as posies, com os mesmos ndices (pr-passo de profundidade)
+	GLuint positionBuffer = 0;
+	GLuint depthVao = 0;
+
+	// Apaga os buffers e o VAO (chamar com o contexto ainda ativo)
+	void release();
+};
+
+// Envia a geometria para a GPU com o formato de vrtice do uber-shader (atributos 0 a 3)
+// e,  parte, s as posies (atributo 0) para o pr-passo de profundidade
+GeometryBuffers uploadGeometry(const Geometry& geometry);
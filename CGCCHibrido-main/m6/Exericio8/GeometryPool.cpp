@@ -0,0 +1,94 @@
+#include "GeometryPool.h"
+
+#include <iostream>
+
+#include "GLDevice.h"
+#include "GLState.h"
+#include "InstancedRenderer.h"
+#include "Profiler.h"
+
+static const GLsizeiptr VERTEX_BYTES = Geometry::FLOATS_PER_VERTEX * sizeof(GLfloat);
+
+GeometryPool::GeometryPool() : vao(0), vertexBuffer(0), indexBuffer(0), vertexCapacity(0), indexCapacity(0), vertexUsed(0), indexUsed(0)
+{
+}
+
+void GeometryPool::init(int vertexCapacity, int indexCapacity)
+{
+	this->vertexCapacity = vertexCapacity;
+	this->indexCapacity = indexCapacity;
+	vertexBuffer = glDevice.createBuffer(vertexCapacity * VERTEX_BYTES, NULL, GL_DYNAMIC_STORAGE_BIT);
+	indexBuffer = glDevice.createBuffer(indexCapacity * (GLsizeiptr)sizeof(GLuint), NULL, GL_DYNAMIC_STORAGE_BIT);
+
+	vao = glDevice.createVertexArray(instancedVertexLayout());
+	glDevice.vertexBuffer(vao, 0, vertexBuffer, 0, (GLsizei)VERTEX_BYTES);
+	glDevice.elementBuffer(vao, indexBuffer);
+}
+
+void GeometryPool::reserve(int vertices, int indices)
+{
+	if (vertexUsed + vertices > vertexCapacity)
+	{
+		int capacity = vertexCapacity;
+		while (capacity < vertexUsed + vertices)
+			capacity *= 2;
+		GLuint buffer = glDevice.createBuffer(capacity * VERTEX_BYTES, NULL, GL_DYNAMIC_STORAGE_BIT);
+		glDevice.copyBuffer(vertexBuffer, buffer, 0, 0, vertexUsed * VERTEX_BYTES);
+		glState.deleteBuffer(vertexBuffer);
+		vertexBuffer = buffer;
+		vertexCapacity = capacity;
+		glDevice.vertexBuffer(vao, 0, vertexBuffer, 0, (GLsizei)VERTEX_BYTES);
+		std::cout << "GeometryPool: buffer de vrtices cresceu para " << capacity << " vrtices" << std::endl;
+	}
+	if (indexUsed + indices > indexCapacity)
+	{
+		int capacity = indexCapacity;
+		while (capacity < indexUsed + indices)
+			capacity *= 2;
+		GLuint buffer = glDevice.createBuffer(capacity * (GLsizeiptr)sizeof(GLuint), NULL, GL_DYNAMIC_STORAGE_BIT);
+		glDevice.copyBuffer(indexBuffer, buffer, 0, 0, indexUsed * (GLsizeiptr)sizeof(GLuint));
+		glState.deleteBuffer(indexBuffer);
+		indexBuffer = buffer;
+		indexCapacity = capacity;
+		glDevice.elementBuffer(vao, indexBuffer);
+		std::cout << "GeometryPool: buffer de ndices cresceu para " << capacity << " ndices" << std::endl;
+	}
+}
+
+int GeometryPool::add(const Geometry& geometry)
+{
+	reserve(geometry.vertexCount(), geometry.indexCount());
+
+	PoolMesh mesh;
+	mesh.baseVertex = vertexUsed;
+	mesh.firstIndex = indexUsed;
+	mesh.indexCount = geometry.indexCount();
+	mesh.vertexCount = geometry.vertexCount();
+
+	glDevice.updateBuffer(vertexBuffer, vertexUsed * VERTEX_BYTES, geometry.vertexBytes(), geometry.vertices.data());
+	glDevice.updateBuffer(indexBuffer, indexUsed * (GLsizeiptr)sizeof(GLuint), geometry.indexBytes(), geometry.indices.data());
+	PROFILE_UPLOAD(geometry.vertexBytes() + geometry.indexBytes());
+	vertexUsed += mesh.vertexCount;
+	indexUsed += mesh.indexCount;
+
+	meshes.push_back(mesh);
+	return (int)meshes.size() - 1;
+}
+
+void GeometryPool::instanceBuffer(GLuint buffer, GLintptr offset)
+{
+	glDevice.vertexBuffer(vao, 1, buffer, offset, sizeof(InstanceData), 1);
+}
+
+void GeometryPool::release()
+{
+	if (vao != 0)
+		glDevice.deleteVertexArray(vao);
+	if (vertexBuffer != 0)
+		glState.deleteBuffer(vertexBuffer);
+	if (indexBuffer != 0)
+		glState.deleteBuffer(indexBuffer);
+	vao = vertexBuffer = indexBuffer = 0;
+	vertexCapacity = indexCapacity = vertexUsed = indexUsed = 0;
+	meshes.clear();
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <vector>
+
+//GLAD
+#include <glad/glad.h>
+
+#include "Geometry.h"
+
+// Onde uma malha ficou dentro dos buffers do pool (o que vai num comando indireto)
+struct PoolMesh
+{
+	GLint baseVertex = 0; //Somado a cada ndice da malha
+	GLuint firstIndex = 0;
+	GLsizei indexCount = 0;
+	int vertexCount = 0;
+};
+
+// Guarda os vrtices e ndices de todas as malhas em dois buffers grandes
+// compartilhados, com um VAO s (o formato das variantes INSTANCED). Cada
+// malha ocupa um trecho contnuo; os ndices ficam relativos  prpria malha
+// e o baseVertex do draw desloca para o trecho certo. Assim malhas
+// diferentes podem ser desenhadas sem trocar de VAO, inclusive num nico
+// glMultiDrawElementsIndirect. Quando enche, os buffers dobram de tamanho e
+// o contedo  copiado pela GPU.
+class GeometryPool
+{
+public:
+	GeometryPool();
+
+	// Capacidade inicial em vrtices e em ndices
+	void init(int vertexCapacity = 65536, int indexCapacity = 196608);
+	// Copia a geometria para o pool e devolve o id da malha
+	int add(const Geometry& geometry);
+	const PoolMesh& mesh(int id) const { return meshes[id]; }
+	int meshCount() const { return (int)meshes.size(); }
+
+	GLuint vertexArray() const { return vao; }
+	// Liga o buffer de InstanceData ao ponto de ligao 1 do VAO
+	void instanceBuffer(GLuint buffer, GLintptr offset = 0);
+	// Apaga os buffers e o VAO (chamar com o contexto ainda ativo)
+	void release();
+
+	int usedVertices() const { return vertexUsed; }
+	int usedIndices() const { return indexUsed; }
+
+protected:
+	// Garante espao para mais 'vertices' vrtices e 'indices' ndices
+	void reserve(int vertices, int indices);
+
+	GLuint vao;
+	GLuint vertexBuffer, indexBuffer;
+	int vertexCapacity, indexCapacity;
+	int vertexUsed, indexUsed;
+	std::vector<PoolMesh> meshes;
+};
@@ -0,0 +1,94 @@
+#include "GpuQuery.h"
+
+void GpuQuery::begin(GLuint64 tag)
+{
+	if (queries[0] == 0)
+		glGenQueries(target == GL_TIMESTAMP ? LATENCY * 2 : LATENCY, queries);
+
+	// Libera os objetos prontos sem consumir os resultados (ficam na fila para o poll())
+	collect();
+	active = -1;
+	if (pending[next])
+		return; // A GPU ainda no entregou esse objeto: pula o quadro em vez de esperar
+	active = next;
+	tags[active] = tag;
+	if (target == GL_TIMESTAMP)
+		glQueryCounter(queries[LATENCY + active], GL_TIMESTAMP);
+	else
+		glBeginQuery(target, queries[active]);
+}
+
+void GpuQuery::end()
+{
+	if (active < 0)
+		return;
+	if (target == GL_TIMESTAMP)
+		glQueryCounter(queries[active], GL_TIMESTAMP);
+	else
+		glEndQuery(target);
+	pending[active] = true;
+	active = -1;
+	next = (next + 1) % LATENCY;
+}
+
+void GpuQuery::collect()
+{
+	// Do mais antigo (o prximo a ser reutilizado) para o mais novo; as queries terminam
+	// em ordem, ento a primeira pendente que no est pronta encerra a busca
+	for (int i = 0; i < LATENCY; i++)
+	{
+		int slot = (next + i) % LATENCY;
+		if (!pending[slot])
+			continue;
+		GLint available = 0;
+		glGetQueryObjectiv(queries[slot], GL_QUERY_RESULT_AVAILABLE, &available);
+		if (!available)
+			break;
+		GLuint64 value = 0;
+		glGetQueryObjectui64v(queries[slot], GL_QUERY_RESULT, &value);
+		if (target == GL_TIMESTAMP)
+		{
+			// O fim ficou pronto, ento o incio tambm
+			GLuint64 start = 0;
+			glGetQueryObjectui64v(queries[LATENCY + slot], GL_QUERY_RESULT, &start);
+			value -= start;
+		}
+		pending[slot] = false;
+
+		if (readyCount == QUEUE_SIZE)
+		{
+			readyFirst = (readyFirst + 1) % QUEUE_SIZE;
+			readyCount--;
+			dropped++;
+		}
+		int position = (readyFirst + readyCount) % QUEUE_SIZE;
+		readyResults[position] = value;
+		readyTags[position] = tags[slot];
+		readyCount++;
+	}
+}
+
+bool GpuQuery::poll()
+{
+	collect();
+	if (readyCount == 0)
+		return false;
+	lastResult = readyResults[readyFirst];
+	lastTag = readyTags[readyFirst];
+	readyFirst = (readyFirst + 1) % QUEUE_SIZE;
+	readyCount--;
+	valid = true;
+	return true;
+}
+
+void GpuQuery::release()
+{
+	if (queries[0] != 0)
+		glDeleteQueries(target == GL_TIMESTAMP ? LATENCY * 2 : LATENCY, queries);
+	for (int i = 0; i < LATENCY * 2; i++)
+		queries[i] = 0;
+	for (int i = 0; i < LATENCY; i++)
+		pending[i] = false;
+	readyFirst = readyCount = 0;
+	valid = false;
+}
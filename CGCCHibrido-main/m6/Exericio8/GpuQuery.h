@@ -0,0 +1,60 @@
+#pragma once
+
+//GLAD
+#include <glad/glad.h>
+
+// Query da OpenGL (GL_TIME_ELAPSED, GL_SAMPLES_PASSED...) com vrios objetos
+// em rodzio: o resultado de um quadro s  lido alguns quadros depois, quando
+// a GPU j terminou, ento ler nunca trava o pipeline. Se nenhum objeto
+// estiver livre a medio do quadro  pulada.
+// Com GL_TIMESTAMP begin() e end() gravam um glQueryCounter cada e o resultado
+//  a diferena: mede o mesmo que GL_TIME_ELAPSED, mas pode ficar em volta de
+// outras medies de tempo (duas GL_TIME_ELAPSED no podem se aninhar).
+// Os resultados prontos vo para uma fila, na ordem das medies, e poll()
+// entrega um por vez: quem chama repete at poll() retornar false.
+class GpuQuery
+{
+public:
+	static const int LATENCY = 3;
+	// Resultados prontos guardados  espera do poll(); cheia, perde o mais antigo
+	static const int QUEUE_SIZE = LATENCY * 2;
+
+	GpuQuery(GLenum target = GL_TIME_ELAPSED) : target(target) {}
+
+	// 'tag' acompanha a medio e volta junto com o resultado (ex.: o instante do quadro)
+	void begin(GLuint64 tag = 0);
+	void end();
+	// Tira da fila o resultado mais antigo ainda no lido (para result() e resultTag());
+	// false se no h nenhum. Chamar em lao: while (query.poll()) ...
+	bool poll();
+	// Apaga as queries (chamar com o contexto ainda ativo)
+	void release();
+
+	bool hasResult() const { return valid; }
+	// Resultado tirado pelo ltimo poll() (nanossegundos para GL_TIME_ELAPSED e GL_TIMESTAMP)
+	GLuint64 result() const { return lastResult; }
+	double milliseconds() const { return lastResult / 1000000.0; }
+	GLuint64 resultTag() const { return lastTag; }
+
+	// Resultados perdidos com a fila cheia (ningum chamou poll() a tempo)
+	int droppedResults() const { return dropped; }
+
+protected:
+	// Passa os objetos que a GPU j entregou, do mais antigo para o mais novo, para a fila
+	void collect();
+
+	GLenum target;
+	GLuint queries[LATENCY * 2] = { 0 }; //Com GL_TIMESTAMP, incio e fim de cada medio
+	bool pending[LATENCY] = { false };
+	GLuint64 tags[LATENCY] = { 0 };
+	int next = 0;
+	int active = -1;
+	GLuint64 readyResults[QUEUE_SIZE] = { 0 };
+	GLuint64 readyTags[QUEUE_SIZE] = { 0 };
+	int readyFirst = 0;
+	int readyCount = 0;
+	int dropped = 0;
+	GLuint64 lastResult = 0;
+	GLuint64 lastTag = 0;
+	bool valid = false;
+};
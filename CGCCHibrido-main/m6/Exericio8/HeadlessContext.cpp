@@ -0,0 +1,170 @@
+#include "HeadlessContext.h"
+
+#include <cstring>
+#include <iostream>
+
+#if CG_HEADLESS_EGL
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
+
+//GLFW
+#include <GLFW/glfw3.h>
+
+HeadlessContext::HeadlessContext() : backendName("nenhum"), hiddenWindow(nullptr), display(nullptr), context(nullptr), surface(nullptr)
+{
+}
+
+#if CG_HEADLESS_EGL
+
+static bool hasExtension(const char* extensions, const char* name)
+{
+	return extensions && strstr(extensions, name) != nullptr;
+}
+
+bool HeadlessContext::create()
+{
+	// Surfaceless do Mesa primeiro; o display padro pode precisar de um servidor X
+	EGLDisplay eglDisplay = EGL_NO_DISPLAY;
+	PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+	if (getPlatformDisplay && hasExtension(eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS), "EGL_MESA_platform_surfaceless"))
+	{
+		eglDisplay = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+		backendName = "EGL surfaceless";
+		if (eglDisplay != EGL_NO_DISPLAY && !eglInitialize(eglDisplay, nullptr, nullptr))
+			eglDisplay = EGL_NO_DISPLAY;
+	}
+	if (eglDisplay == EGL_NO_DISPLAY)
+	{
+		eglDisplay = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+		backendName = "EGL pbuffer";
+		if (eglDisplay == EGL_NO_DISPLAY || !eglInitialize(eglDisplay, nullptr, nullptr))
+		{
+			std::cout << "EGL: nenhum display disponivel" << std::endl;
+			return false;
+		}
+	}
+	display = eglDisplay;
+	eglBindAPI(EGL_OPENGL_API);
+
+	const EGLint configAttributes[] = {
+		EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+		EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+		EGL_RED_SIZE, 8, EGL_GREEN_SIZE, 8, EGL_BLUE_SIZE, 8,
+		EGL_NONE
+	};
+	EGLConfig config;
+	EGLint configs = 0;
+	if (!eglChooseConfig(eglDisplay, configAttributes, &config, 1, &configs) || configs == 0)
+	{
+		std::cout << "EGL: nenhuma configuracao com OpenGL" << std::endl;
+		destroy();
+		return false;
+	}
+
+	// 4.5 core e, se o driver no tiver, 3.3 core
+	const EGLint versions[2][2] = { { 4, 5 }, { 3, 3 } };
+	EGLContext eglContext = EGL_NO_CONTEXT;
+	for (int i = 0; i < 2 && eglContext == EGL_NO_CONTEXT; i++)
+	{
+		const EGLint contextAttributes[] = {
+			EGL_CONTEXT_MAJOR_VERSION, versions[i][0],
+			EGL_CONTEXT_MINOR_VERSION, versions[i][1],
+			EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+			EGL_NONE
+		};
+		eglContext = eglCreateContext(eglDisplay, config, EGL_NO_CONTEXT, contextAttributes);
+	}
+	if (eglContext == EGL_NO_CONTEXT)
+	{
+		std::cout << "EGL: nao foi possivel criar um contexto 3.3 core" << std::endl;
+		destroy();
+		return false;
+	}
+	context = eglContext;
+
+	// Tudo  desenhado num FBO: a superfcie s existe se o contexto no puder ficar sem nenhuma
+	EGLSurface eglSurface = EGL_NO_SURFACE;
+	if (!hasExtension(eglQueryString(eglDisplay, EGL_EXTENSIONS), "EGL_KHR_surfaceless_context"))
+	{
+		const EGLint surfaceAttributes[] = { EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE };
+		eglSurface = eglCreatePbufferSurface(eglDisplay, config, surfaceAttributes);
+	}
+	surface = eglSurface;
+	if (!eglMakeCurrent(eglDisplay, eglSurface, eglSurface, eglContext))
+	{
+		std::cout << "EGL: eglMakeCurrent falhou (0x" << std::hex << eglGetError() << std::dec << ")" << std::endl;
+		destroy();
+		return false;
+	}
+	return true;
+}
+
+void HeadlessContext::destroy()
+{
+	if (!display)
+		return;
+	eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+	if (surface)
+		eglDestroySurface(display, surface);
+	if (context)
+		eglDestroyContext(display, context);
+	eglTerminate(display);
+	display = context = surface = nullptr;
+}
+
+void* HeadlessContext::getProcAddress(const char* name)
+{
+	return (void*)eglGetProcAddress(name);
+}
+
+#else
+
+bool HeadlessContext::create()
+{
+	if (!glfwInit())
+	{
+		std::cout << "Failed to initialize GLFW" << std::endl;
+		return false;
+	}
+	glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+	// OSMesa (llvmpipe, sem GPU) primeiro; sem ele, o contexto nativo da janela escondida
+	const int apis[2] = { GLFW_OSMESA_CONTEXT_API, GLFW_NATIVE_CONTEXT_API };
+	const char* names[2] = { "OSMesa", "janela escondida" };
+	const int versions[2][2] = { { 4, 5 }, { 3, 3 } };
+	for (int a = 0; a < 2 && !hiddenWindow; a++)
+	{
+		glfwWindowHint(GLFW_CONTEXT_CREATION_API, apis[a]);
+		for (int v = 0; v < 2 && !hiddenWindow; v++)
+		{
+			glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, versions[v][0]);
+			glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, versions[v][1]);
+			hiddenWindow = glfwCreateWindow(64, 64, "headless", nullptr, nullptr);
+		}
+		backendName = names[a];
+	}
+	if (!hiddenWindow)
+	{
+		std::cout << "GLFW: nao foi possivel criar um contexto 3.3 core" << std::endl;
+		return false;
+	}
+	glfwMakeContextCurrent(hiddenWindow);
+	return true;
+}
+
+void HeadlessContext::destroy()
+{
+	if (!hiddenWindow)
+		return;
+	glfwDestroyWindow(hiddenWindow);
+	hiddenWindow = nullptr;
+}
+
+void* HeadlessContext::getProcAddress(const char* name)
+{
+	return (void*)glfwGetProcAddress(name);
+}
+
+#endif
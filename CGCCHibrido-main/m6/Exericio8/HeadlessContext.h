@@ -0,0 +1,44 @@
+#pragma once
+
+// Backend do contexto sem janela. Fora do Windows  EGL: a plataforma
+// surfaceless do Mesa (no precisa de servidor grfico nem de GPU, roda no
+// llvmpipe) ou, sem ela, o display padro com um pbuffer. No Windows a GLFW
+// cria uma janela escondida com contexto OSMesa (osmesa.dll do Mesa ao lado
+// do executvel); sem OSMesa fica o contexto nativo da janela escondida.
+#ifndef CG_HEADLESS_EGL
+#ifdef _WIN32
+#define CG_HEADLESS_EGL 0
+#else
+#define CG_HEADLESS_EGL 1
+#endif
+#endif
+
+struct GLFWwindow;
+
+// Contexto OpenGL para rodar sem janela (CI, mquinas sem GPU). Como no h
+// tela, quem usa desenha num framebuffer prprio (OffscreenTarget).
+class HeadlessContext
+{
+public:
+	HeadlessContext();
+	~HeadlessContext() { destroy(); }
+
+	// Cria um contexto 4.5 core (ou 3.3 core, se o driver no tiver) e o torna atual
+	bool create();
+	void destroy();
+
+	// Ponteiros das funes da OpenGL, para o gladLoadGLLoader
+	static void* getProcAddress(const char* name);
+	// Nome do backend criado ("EGL surfaceless", "OSMesa"...)
+	const char* backend() const { return backendName; }
+	// Janela escondida do backend da GLFW (nullptr com EGL)
+	GLFWwindow* window() const { return hiddenWindow; }
+
+protected:
+	const char* backendName;
+	GLFWwindow* hiddenWindow;
+	// EGLDisplay, EGLContext e EGLSurface (ponteiros opacos, para no expor o EGL aqui)
+	void* display;
+	void* context;
+	void* surface;
+};
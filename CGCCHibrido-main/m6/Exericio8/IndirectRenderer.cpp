@@ -0,0 +1,127 @@
+#include "IndirectRenderer.h"
+
+#include "GLDevice.h"
+#include "GLState.h"
+#include "Profiler.h"
+
+IndirectRenderer::IndirectRenderer(GeometryPool& pool) : pool(pool), commandBuffer(0), instanceBuffer(0), capacity(0), draws(0)
+{
+	for (int i = 0; i < InstancedRenderer::MAX_MATERIALS; i++)
+		palette[i] = glm::vec3(1.0f);
+}
+
+void IndirectRenderer::setMaterialColor(int index, glm::vec3 color)
+{
+	if (index >= 0 && index < InstancedRenderer::MAX_MATERIALS)
+		palette[index] = color;
+}
+
+void IndirectRenderer::clear()
+{
+	commands.clear();
+	instances.clear();
+}
+
+void IndirectRenderer::add(int mesh, const glm::mat4& model, GLuint material)
+{
+	const PoolMesh& range = pool.mesh(mesh);
+
+	DrawElementsIndirectCommand command;
+	command.count = range.indexCount;
+	command.instanceCount = 1;
+	command.firstIndex = range.firstIndex;
+	command.baseVertex = range.baseVertex;
+	command.baseInstance = (GLuint)instances.size();
+	commands.push_back(command);
+
+	InstanceData instance;
+	instance.model = model;
+	instance.material = material < InstancedRenderer::MAX_MATERIALS ? material : 0;
+	instances.push_back(instance);
+}
+
+void IndirectRenderer::reserve(int count)
+{
+	commands.reserve(count);
+	instances.reserve(count);
+}
+
+void IndirectRenderer::growBuffers()
+{
+	int needed = (int)commands.size();
+	if (needed <= capacity)
+		return;
+
+	int newCapacity = capacity > 0 ? capacity : 64;
+	while (newCapacity < needed)
+		newCapacity *= 2;
+
+	if (commandBuffer != 0)
+		glState.deleteBuffer(commandBuffer);
+	if (instanceBuffer != 0)
+		glState.deleteBuffer(instanceBuffer);
+	commandBuffer = glDevice.createBuffer((GLsizeiptr)newCapacity * sizeof(DrawElementsIndirectCommand), NULL, GL_DYNAMIC_STORAGE_BIT);
+	instanceBuffer = glDevice.createBuffer((GLsizeiptr)newCapacity * sizeof(InstanceData), NULL, GL_DYNAMIC_STORAGE_BIT);
+	capacity = newCapacity;
+}
+
+void IndirectRenderer::draw(ShaderVariantCache& shaders, const Material& material, const std::function<void(Shader*)>& setupShader)
+{
+	draws = 0;
+	if (commands.empty())
+		return;
+
+	growBuffers();
+	GLsizeiptr instanceBytes = (GLsizeiptr)instances.size() * sizeof(InstanceData);
+	glDevice.orphanBuffer(instanceBuffer, (GLsizeiptr)capacity * sizeof(InstanceData));
+	glDevice.updateBuffer(instanceBuffer, 0, instanceBytes, instances.data());
+	PROFILE_UPLOAD(instanceBytes);
+
+	Shader* shader = shaders.get(material.features() | SHADER_INSTANCED);
+	shader->Use();
+	setupShader(shader);
+	shader->setVec3Array("materialColors", InstancedRenderer::MAX_MATERIALS, &palette[0].x);
+	material.apply(shader);
+	glState.bindVertexArray(pool.vertexArray());
+
+	if (glDevice.multiDrawIndirect())
+	{
+		GLsizeiptr commandBytes = (GLsizeiptr)commands.size() * sizeof(DrawElementsIndirectCommand);
+		glDevice.orphanBuffer(commandBuffer, (GLsizeiptr)capacity * sizeof(DrawElementsIndirectCommand));
+		glDevice.updateBuffer(commandBuffer, 0, commandBytes, commands.data());
+		PROFILE_UPLOAD(commandBytes);
+
+		pool.instanceBuffer(instanceBuffer);
+		glState.bindBuffer(GL_DRAW_INDIRECT_BUFFER, commandBuffer);
+		glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, 0, (GLsizei)commands.size(), 0);
+
+		long long triangles = 0;
+		for (const DrawElementsIndirectCommand& command : commands)
+			triangles += command.count / 3;
+		PROFILE_DRAW(triangles);
+		draws = 1;
+		return;
+	}
+
+	// Sem baseInstance na 3.3: o deslocamento vai no prprio ponto de ligao das instncias
+	for (const DrawElementsIndirectCommand& command : commands)
+	{
+		pool.instanceBuffer(instanceBuffer, (GLintptr)command.baseInstance * sizeof(InstanceData));
+		glDrawElementsInstancedBaseVertex(GL_TRIANGLES, command.count, GL_UNSIGNED_INT,
+			(GLvoid*)(command.firstIndex * sizeof(GLuint)), command.instanceCount, command.baseVertex);
+		PROFILE_DRAW_INSTANCED(command.count / 3, command.instanceCount);
+		draws++;
+	}
+}
+
+void IndirectRenderer::release()
+{
+	if (commandBuffer != 0)
+		glState.deleteBuffer(commandBuffer);
+	if (instanceBuffer != 0)
+		glState.deleteBuffer(instanceBuffer);
+	commandBuffer = instanceBuffer = 0;
+	capacity = 0;
+	commands.clear();
+	instances.clear();
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <vector>
+#include <functional>
+
+//GLM
+#include <glm/glm.hpp>
+
+#include "GeometryPool.h"
+#include "InstancedRenderer.h"
+#include "Material.h"
+
+// Comando de desenho lido pela GPU do GL_DRAW_INDIRECT_BUFFER (layout fixo da especificao)
+struct DrawElementsIndirectCommand
+{
+	GLuint count;
+	GLuint instanceCount;
+	GLuint firstIndex;
+	GLint baseVertex;
+	GLuint baseInstance;
+};
+
+// Desenha um quadro inteiro de malhas diferentes, todas de um GeometryPool,
+// com um nico glMultiDrawElementsIndirect. Cada add() vira um comando com
+// instanceCount 1 e baseInstance apontando para a sua InstanceData; como o
+// ponto de ligao 1 tem divisor 1, o baseInstance  o que faz cada objeto
+// ler a prpria matriz e material. Os comandos so montados na CPU e
+// enviados num buffer s, ento o custo de submisso no depende de quantos
+// objetos h. Sem multi-draw indirect (contextos 3.3) os comandos so
+// desenhados um a um com glDrawElementsInstancedBaseVertex.
+class IndirectRenderer
+{
+public:
+	explicit IndirectRenderer(GeometryPool& pool);
+
+	void setMaterialColor(int index, glm::vec3 color);
+
+	// Esvazia os comandos (incio do quadro)
+	void clear();
+	void add(int mesh, const glm::mat4& model, GLuint material = 0);
+	void reserve(int count);
+
+	// Envia comandos e instncias e desenha tudo com a variante INSTANCED do material.
+	// 'setupShader' recebe a variante j ativa, para os uniforms do quadro.
+	void draw(ShaderVariantCache& shaders, const Material& material, const std::function<void(Shader*)>& setupShader);
+	// Apaga os buffers de comandos e instncias (o pool  liberado  parte)
+	void release();
+
+	int commandCount() const { return (int)commands.size(); }
+	int drawCount() const { return draws; }
+
+protected:
+	// Garante que os buffers comportam todos os comandos do quadro
+	void growBuffers();
+
+	GeometryPool& pool;
+	std::vector<DrawElementsIndirectCommand> commands;
+	std::vector<InstanceData> instances;
+	GLuint commandBuffer, instanceBuffer;
+	int capacity; //Comandos (e instncias) que cabem nos buffers
+	glm::vec3 palette[InstancedRenderer::MAX_MATERIALS];
+	int draws;
+};
@@ -0,0 +1,187 @@
+#include "InputSystem.h"
+
+#include <iostream>
+#include <cstring>
+
+//GLFW
+#include <GLFW/glfw3.h>
+
+InputSystem inputSystem;
+
+static const char INPUT_MAGIC[4] = { 'C', 'G', 'I', 'N' };
+static const uint32_t INPUT_VERSION = 1;
+
+template<typename T>
+static void writeValue(std::ofstream& file, const T& value)
+{
+	file.write((const char*)&value, sizeof(T));
+}
+
+template<typename T>
+static bool readValue(std::ifstream& file, T& value)
+{
+	return (bool)file.read((char*)&value, sizeof(T));
+}
+
+InputSystem::InputSystem() : head(0), tail(0), dropped(0), startTime(Clock::now())
+{
+	memset(bindings, -1, sizeof(bindings));
+	memset(keyDown, 0, sizeof(keyDown));
+	memset(down, 0, sizeof(down));
+	memset(presses, 0, sizeof(presses));
+}
+
+void InputSystem::bind(int key, InputAction action)
+{
+	if (key >= 0 && key < MAX_KEYS)
+		bindings[key] = (int8_t)action;
+}
+
+void InputSystem::push(int key, int action)
+{
+	if (action != GLFW_PRESS && action != GLFW_RELEASE)
+		return;
+	uint32_t write = head.load(std::memory_order_relaxed);
+	// Cheia: o consumidor est um giro inteiro atrs
+	if (write - tail.load(std::memory_order_acquire) >= (uint32_t)QUEUE_SIZE)
+	{
+		dropped.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+	InputEvent& event = queue[write & (QUEUE_SIZE - 1)];
+	event.time = std::chrono::duration<double>(Clock::now() - startTime).count();
+	event.key = key;
+	event.action = action;
+	// O evento fica visvel para o consumidor s depois de escrito
+	head.store(write + 1, std::memory_order_release);
+}
+
+void InputSystem::apply(const InputEvent& event)
+{
+	if (event.key < 0 || event.key >= MAX_KEYS)
+		return;
+	// Um press repetido (ou um release sem press) no mexe na contagem da ao
+	bool pressedNow = (event.action == GLFW_PRESS);
+	if (keyDown[event.key] == pressedNow)
+		return;
+	keyDown[event.key] = pressedNow;
+	int action = bindings[event.key];
+	if (action < 0)
+		return;
+	if (pressedNow)
+	{
+		down[action]++;
+		presses[action]++;
+	}
+	else
+		down[action]--;
+}
+
+double InputSystem::update(double elapsed)
+{
+	memset(presses, 0, sizeof(presses));
+	stats.dropped = dropped.load(std::memory_order_relaxed);
+
+	// Eventos do teclado neste quadro
+	events.clear();
+	uint32_t read = tail.load(std::memory_order_relaxed);
+	uint32_t end = head.load(std::memory_order_acquire);
+	for (; read != end; read++)
+		events.push_back(queue[read & (QUEUE_SIZE - 1)]);
+	tail.store(read, std::memory_order_release);
+
+	if (replaying())
+	{
+		// Do teclado s vale o pedido para sair; o resto vem do arquivo
+		for (const InputEvent& event : events)
+			if (event.action == GLFW_PRESS && event.key >= 0 && event.key < MAX_KEYS && bindings[event.key] == ACTION_QUIT)
+				presses[ACTION_QUIT]++;
+		if (replayFrame(elapsed))
+			stats.replayedFrames++;
+		else
+		{
+			std::cout << "Input: fim da reproducao depois de " << stats.replayedFrames << " quadros" << std::endl;
+			replayFile.close();
+		}
+		return elapsed;
+	}
+
+	for (const InputEvent& event : events)
+		apply(event);
+	stats.events += events.size();
+
+	if (recording())
+	{
+		writeValue(recordFile, elapsed);
+		writeValue(recordFile, (uint32_t)events.size());
+		for (const InputEvent& event : events)
+		{
+			writeValue(recordFile, event.time);
+			writeValue(recordFile, event.key);
+			writeValue(recordFile, event.action);
+		}
+		stats.recordedFrames++;
+	}
+	return elapsed;
+}
+
+bool InputSystem::replayFrame(double& elapsed)
+{
+	double recordedElapsed;
+	uint32_t count;
+	if (!readValue(replayFile, recordedElapsed) || !readValue(replayFile, count))
+		return false;
+	for (uint32_t i = 0; i < count; i++)
+	{
+		InputEvent event;
+		if (!readValue(replayFile, event.time) || !readValue(replayFile, event.key) || !readValue(replayFile, event.action))
+			return false;
+		apply(event);
+		stats.events++;
+	}
+	elapsed = recordedElapsed;
+	return true;
+}
+
+bool InputSystem::startRecording(const std::string& path)
+{
+	stop();
+	recordFile.open(path.c_str(), std::ios::binary);
+	if (!recordFile.is_open())
+	{
+		std::cout << "Erro ao criar o arquivo " << path << std::endl;
+		return false;
+	}
+	recordFile.write(INPUT_MAGIC, sizeof(INPUT_MAGIC));
+	writeValue(recordFile, INPUT_VERSION);
+	return true;
+}
+
+bool InputSystem::startReplay(const std::string& path)
+{
+	stop();
+	replayFile.open(path.c_str(), std::ios::binary);
+	if (!replayFile.is_open())
+	{
+		std::cout << "Problema ao encontrar o arquivo " << path << std::endl;
+		return false;
+	}
+	char magic[4];
+	uint32_t version = 0;
+	if (!replayFile.read(magic, sizeof(magic)) || memcmp(magic, INPUT_MAGIC, sizeof(magic)) != 0
+		|| !readValue(replayFile, version) || version != INPUT_VERSION)
+	{
+		std::cout << "Arquivo de input invalido: " << path << std::endl;
+		replayFile.close();
+		return false;
+	}
+	return true;
+}
+
+void InputSystem::stop()
+{
+	if (recordFile.is_open())
+		recordFile.close();
+	if (replayFile.is_open())
+		replayFile.close();
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Aes da aplicao; as teclas s chegam nelas pelo mapeamento do bind()
+enum InputAction
+{
+	ACTION_MOVE_LEFT,
+	ACTION_MOVE_RIGHT,
+	ACTION_MOVE_UP,
+	ACTION_MOVE_DOWN,
+	ACTION_MOVE_FORWARD,
+	ACTION_MOVE_BACK,
+	ACTION_SCALE_UP,
+	ACTION_SCALE_DOWN,
+	ACTION_TOGGLE_DEFERRED,
+	ACTION_PICK,
+	ACTION_QUIT,
+	ACTION_COUNT
+};
+
+// Evento de teclado com a hora em que chegou (segundos desde a criao do InputSystem)
+struct InputEvent
+{
+	double time;
+	int32_t key; //Cdigo GLFW
+	int32_t action; //GLFW_PRESS ou GLFW_RELEASE
+};
+
+// Contagens do InputSystem desde o incio
+struct InputStats
+{
+	long long events = 0; //Eventos consumidos
+	long long dropped = 0; //Perdidos com a fila cheia
+	long long recordedFrames = 0;
+	long long replayedFrames = 0;
+};
+
+// Entrada de teclado em eventos. O callback da GLFW s pe o evento numa fila
+// circular sem trava (um produtor, um consumidor) e update(), uma vez por
+// quadro, consome a fila e atualiza o estado das aes. Uma tecla apertada e
+// solta entre dois quadros no se perde: a ao conta como ativa naquele quadro.
+//
+// Com startRecording() cada quadro vai para um arquivo binrio com o tempo do
+// quadro e os eventos consumidos nele; com startReplay() os quadros gravados
+// voltam na mesma ordem no lugar do teclado (s ACTION_QUIT continua vindo do
+// teclado) e update() devolve o tempo gravado, ento a simulao repete a
+// sesso quadro a quadro. Formato (little-endian):
+//   "CGIN" | verso (uint32)
+//   por quadro: tempo do quadro (double) | eventos (uint32) | eventos (double, int32, int32)
+class InputSystem
+{
+public:
+	static const int QUEUE_SIZE = 1024; //Potncia de 2
+	static const int MAX_KEYS = 512; //Acima de GLFW_KEY_LAST
+
+	InputSystem();
+	~InputSystem() { stop(); }
+
+	// Liga a tecla (cdigo GLFW) a uma ao; vrias teclas podem levar  mesma ao
+	void bind(int key, InputAction action);
+
+	// Produtor (callback de teclado): pe o evento na fila. GLFW_REPEAT  ignorado.
+	void push(int key, int action);
+
+	// Consumidor (uma vez por quadro): esvazia a fila, grava ou reproduz e atualiza
+	// as aes. Retorna o tempo do quadro a usar: 'elapsed' ou, reproduzindo, o gravado.
+	double update(double elapsed);
+
+	// Ao segurada agora ou apertada em algum momento do ltimo quadro
+	bool active(InputAction action) const { return down[action] > 0 || presses[action] > 0; }
+	// Vezes que a ao foi apertada no ltimo quadro
+	int pressed(InputAction action) const { return presses[action]; }
+
+	bool startRecording(const std::string& path);
+	bool startReplay(const std::string& path);
+	// Fecha a gravao ou a reproduo
+	void stop();
+	bool recording() const { return recordFile.is_open(); }
+	bool replaying() const { return replayFile.is_open(); }
+
+	const InputStats& totalStats() const { return stats; }
+
+protected:
+	typedef std::chrono::steady_clock Clock;
+
+	// Evento nas aes do mapeamento
+	void apply(const InputEvent& event);
+	// Prximo quadro do arquivo de reproduo nos eventos; false no fim do arquivo
+	bool replayFrame(double& elapsed);
+
+	InputEvent queue[QUEUE_SIZE];
+	std::atomic<uint32_t> head; //Prximo a escrever (s o produtor muda)
+	std::atomic<uint32_t> tail; //Prximo a ler (s o consumidor muda)
+	std::atomic<long long> dropped;
+	Clock::time_point startTime;
+
+	int8_t bindings[MAX_KEYS]; //Ao de cada tecla (-1 = nenhuma)
+	bool keyDown[MAX_KEYS];
+	int down[ACTION_COUNT]; //Teclas seguradas de cada ao
+	int presses[ACTION_COUNT];
+	std::vector<InputEvent> events; //Os que saram da fila no quadro
+
+	std::ofstream recordFile;
+	std::ifstream replayFile;
+	InputStats stats;
+};
+
+// Instncia nica usada por toda a aplicao
+extern InputSystem inputSystem;
@@ -0,0 +1,145 @@
+#include "InstancedRenderer.h"
+
+#include <string>
+#include <cstddef>
+
+#include "GLDevice.h"
+#include "GLState.h"
+#include "Profiler.h"
+
+std::vector<VertexAttribute> instancedVertexLayout()
+{
+	// A mat4 ocupa quatro locations seguidas, uma por coluna
+	const GLuint column = sizeof(glm::vec4);
+	return {
+		{ 0, 3, GL_FLOAT, 0 },
+		{ 1, 3, GL_FLOAT, 3 * sizeof(GLfloat) },
+		{ 2, 2, GL_FLOAT, 6 * sizeof(GLfloat) },
+		{ 3, 3, GL_FLOAT, 8 * sizeof(GLfloat) },
+		{ 4, 4, GL_FLOAT, 0 * column, 1 },
+		{ 5, 4, GL_FLOAT, 1 * column, 1 },
+		{ 6, 4, GL_FLOAT, 2 * column, 1 },
+		{ 7, 4, GL_FLOAT, 3 * column, 1 },
+		{ 8, 1, GL_UNSIGNED_INT, offsetof(InstanceData, material), 1, GL_FALSE, true }
+	};
+}
+
+InstancedRenderer::InstancedRenderer() : draws(0)
+{
+	for (int i = 0; i < MAX_MATERIALS; i++)
+		palette[i] = glm::vec3(1.0f);
+}
+
+int InstancedRenderer::addMesh(const Geometry& geometry, const Material& material)
+{
+	Batch batch;
+	batch.material = material;
+	batch.indexCount = geometry.indexCount();
+	batch.vertexBuffer = glDevice.createBuffer(geometry.vertexBytes(), geometry.vertices.data());
+	batch.indexBuffer = glDevice.createBuffer(geometry.indexBytes(), geometry.indices.data());
+	PROFILE_UPLOAD(geometry.vertexBytes() + geometry.indexBytes());
+
+	batch.vao = glDevice.createVertexArray(instancedVertexLayout());
+	glDevice.vertexBuffer(batch.vao, 0, batch.vertexBuffer, 0, Geometry::FLOATS_PER_VERTEX * sizeof(GLfloat));
+	glDevice.elementBuffer(batch.vao, batch.indexBuffer);
+
+	batches.push_back(batch);
+	return (int)batches.size() - 1;
+}
+
+void InstancedRenderer::setMaterialColor(int index, glm::vec3 color)
+{
+	if (index >= 0 && index < MAX_MATERIALS)
+		palette[index] = color;
+}
+
+void InstancedRenderer::clear()
+{
+	for (Batch& batch : batches)
+		batch.instances.clear();
+}
+
+void InstancedRenderer::add(int mesh, const glm::mat4& model, GLuint material)
+{
+	InstanceData instance;
+	instance.model = model;
+	instance.material = material < MAX_MATERIALS ? material : 0;
+	batches[mesh].instances.push_back(instance);
+}
+
+void InstancedRenderer::reserve(int mesh, int count)
+{
+	batches[mesh].instances.reserve(count);
+}
+
+void InstancedRenderer::growInstanceBuffer(Batch& batch)
+{
+	int needed = (int)batch.instances.size();
+	if (needed <= batch.capacity)
+		return;
+
+	// Cresce em potncias de 2 para no realocar a cada instncia nova
+	int capacity = batch.capacity > 0 ? batch.capacity : 64;
+	while (capacity < needed)
+		capacity *= 2;
+
+	if (batch.instanceBuffer != 0)
+		glState.deleteBuffer(batch.instanceBuffer);
+	batch.instanceBuffer = glDevice.createBuffer((GLsizeiptr)capacity * sizeof(InstanceData), NULL, GL_DYNAMIC_STORAGE_BIT);
+	glDevice.vertexBuffer(batch.vao, 1, batch.instanceBuffer, 0, sizeof(InstanceData), 1);
+	batch.capacity = capacity;
+}
+
+void InstancedRenderer::draw(ShaderVariantCache& shaders, const std::function<void(Shader*)>& setupShader)
+{
+	draws = 0;
+	Shader* current = nullptr;
+	for (Batch& batch : batches)
+	{
+		if (batch.instances.empty())
+			continue;
+
+		growInstanceBuffer(batch);
+		GLsizeiptr bytes = (GLsizeiptr)batch.instances.size() * sizeof(InstanceData);
+		// Descarta o contedo do quadro anterior para o driver no esperar a GPU terminar de l-lo
+		glDevice.orphanBuffer(batch.instanceBuffer, (GLsizeiptr)batch.capacity * sizeof(InstanceData));
+		glDevice.updateBuffer(batch.instanceBuffer, 0, bytes, batch.instances.data());
+		PROFILE_UPLOAD(bytes);
+
+		Shader* shader = shaders.get(batch.material.features() | SHADER_INSTANCED);
+		if (shader != current)
+		{
+			shader->Use();
+			setupShader(shader);
+			shader->setVec3Array("materialColors", MAX_MATERIALS, &palette[0].x);
+			current = shader;
+		}
+		batch.material.apply(shader);
+
+		glState.bindVertexArray(batch.vao);
+		glDrawElementsInstanced(GL_TRIANGLES, batch.indexCount, GL_UNSIGNED_INT, 0, (GLsizei)batch.instances.size());
+		PROFILE_DRAW_INSTANCED(batch.indexCount / 3, (long long)batch.instances.size());
+		draws++;
+	}
+}
+
+void InstancedRenderer::release()
+{
+	for (Batch& batch : batches)
+	{
+		glDevice.deleteVertexArray(batch.vao);
+		glState.deleteBuffer(batch.vertexBuffer);
+		glState.deleteBuffer(batch.indexBuffer);
+		if (batch.instanceBuffer != 0)
+			glState.deleteBuffer(batch.instanceBuffer);
+	}
+	batches.clear();
+}
+
+int InstancedRenderer::instanceCount() const
+{
+	int count = 0;
+	for (const Batch& batch : batches)
+		count += (int)batch.instances.size();
+	return count;
+}
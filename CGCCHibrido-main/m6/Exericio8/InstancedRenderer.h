@@ -0,0 +1,76 @@
+#pragma once
+
+#include <vector>
+#include <functional>
+
+//GLM
+#include <glm/glm.hpp>
+
+#include "GLDevice.h"
+#include "Geometry.h"
+#include "Material.h"
+
+// Dados de uma instncia, como ficam no buffer de instncias (atributos 4 a 8)
+struct InstanceData
+{
+	glm::mat4 model;
+	GLuint material; //ndice na paleta de materiais do renderer
+	GLuint padding[3];
+};
+
+// Formato de vrtice das variantes INSTANCED: ponto de ligao 0 com os
+// vrtices da Geometry (atributos 0 a 3) e 1 com as InstanceData (4 a 8)
+std::vector<VertexAttribute> instancedVertexLayout();
+
+// Desenha muitas cpias da mesma malha com uma chamada s. Cada malha
+// registrada tem seu VAO com dois pontos de ligao: 0 com os vrtices e
+// 1 com as instncias (divisor 1). A cada quadro as instncias so
+// acumuladas com add(), enviadas de uma vez e desenhadas com um
+// glDrawElementsInstanced por malha, usando a variante INSTANCED do uber-shader.
+class InstancedRenderer
+{
+public:
+	// Tamanho da paleta de cores (uniform materialColors do uber.vs)
+	static const int MAX_MATERIALS = 64;
+
+	InstancedRenderer();
+
+	// Registra uma malha; o material define a variante e a textura do lote inteiro
+	int addMesh(const Geometry& geometry, const Material& material);
+	void setMaterialColor(int index, glm::vec3 color);
+
+	// Esvazia as listas de instncias (incio do quadro)
+	void clear();
+	void add(int mesh, const glm::mat4& model, GLuint material = 0);
+	// Reserva espao para 'count' instncias de uma malha (evita realocaes durante o quadro)
+	void reserve(int mesh, int count);
+
+	// Envia as instncias e desenha cada malha com uma chamada. 'setupShader'  chamado
+	// com cada variante usada, j ativa, para os uniforms do quadro (view, projection, luz...)
+	void draw(ShaderVariantCache& shaders, const std::function<void(Shader*)>& setupShader);
+	// Apaga os buffers e VAOs (chamar com o contexto ainda ativo)
+	void release();
+
+	int instanceCount() const;
+	int drawCount() const { return draws; }
+
+protected:
+	struct Batch
+	{
+		GLuint vao = 0;
+		GLuint vertexBuffer = 0;
+		GLuint indexBuffer = 0;
+		GLuint instanceBuffer = 0;
+		int indexCount = 0;
+		int capacity = 0; //Instncias que cabem no instanceBuffer
+		Material material;
+		std::vector<InstanceData> instances;
+	};
+
+	// Garante que o buffer de instncias do lote comporta todas as instncias do quadro
+	void growInstanceBuffer(Batch& batch);
+
+	std::vector<Batch> batches;
+	glm::vec3 palette[MAX_MATERIALS];
+	int draws;
+};
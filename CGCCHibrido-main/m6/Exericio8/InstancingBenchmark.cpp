@@ -0,0 +1,196 @@
+#include "InstancingBenchmark.h"
+
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+//GLM
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include "GLDevice.h"
+#include "GLState.h"
+#include "GpuQuery.h"
+#include "InstancedRenderer.h"
+#include "IndirectRenderer.h"
+
+// Caminhos comparados
+enum BenchmarkPath
+{
+	PATH_SEPARATE_DRAWS, //Um glDrawElements por cubo
+	PATH_INSTANCED, //Um glDrawElementsInstanced
+	PATH_INDIRECT //Um comando por cubo num glMultiDrawElementsIndirect
+};
+
+// Mdias de uma rodada
+struct BenchmarkResult
+{
+	double updateMs = 0.0; //CPU: calcular as matrizes
+	double submitMs = 0.0; //CPU: uniforms + chamadas de draw
+	double gpuMs = 0.0; //GPU: timer query do passo de desenho
+	double frameMs = 0.0; //Quadro inteiro, com o swap
+};
+
+// Matriz do cubo i numa grade de lado 'side', girando com o tempo
+static glm::mat4 cubeTransform(int i, int side, float time)
+{
+	int x = i % side, y = (i / side) % side, z = i / (side * side);
+	glm::vec3 position = (glm::vec3(x, y, z) - glm::vec3((side - 1) * 0.5f)) * 1.5f;
+	glm::mat4 model = glm::translate(glm::mat4(1.0f), position);
+	model = glm::rotate(model, time + i * 0.1f, glm::vec3(0.0f, 1.0f, 0.0f));
+	return glm::scale(model, glm::vec3(0.5f));
+}
+
+static BenchmarkResult runRound(GLFWwindow* window, ShaderVariantCache& shaders, InstancedRenderer& instanced, int mesh,
+	IndirectRenderer& indirect, int poolMesh, GLuint vao, int indexCount, const Material& material, int count, BenchmarkPath path, int frames)
+{
+	int side = (int)std::ceil(std::cbrt((double)count));
+	float distance = side * 1.5f * 1.6f + 3.0f;
+	glm::mat4 view = glm::lookAt(glm::vec3(distance, distance * 0.8f, distance), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+	int width, height;
+	glfwGetFramebufferSize(window, &width, &height);
+	glm::mat4 projection = glm::perspective(glm::radians(45.0f), (float)width / (float)height, 0.1f, distance * 4.0f);
+
+	auto setupShader = [&](Shader* shader) {
+		shader->setMat4("view", glm::value_ptr(view));
+		shader->setMat4("projection", glm::value_ptr(projection));
+		shader->setVec3("lightPos", distance, distance, distance);
+		shader->setVec3("viewPos", distance, distance * 0.8f, distance);
+		shader->setVec3("lightColor", 1.0f, 1.0f, 1.0f);
+	};
+
+	std::vector<glm::mat4> models(count);
+	instanced.reserve(mesh, count);
+	indirect.reserve(count);
+	GpuQuery gpuTimer;
+	BenchmarkResult result;
+	int gpuSamples = 0;
+
+	for (int frame = 0; frame < frames; frame++)
+	{
+		double frameStart = glfwGetTime();
+		glfwPollEvents();
+		glState.beginFrame();
+
+		float time = frame * 0.02f;
+		for (int i = 0; i < count; i++)
+			models[i] = cubeTransform(i, side, time);
+		double updated = glfwGetTime();
+
+		glClearColor(1.0f, 1.0f, 1.0f, 1.0f);
+		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+		gpuTimer.begin();
+		if (path == PATH_INSTANCED)
+		{
+			instanced.clear();
+			for (int i = 0; i < count; i++)
+				instanced.add(mesh, models[i], i % 8);
+			instanced.draw(shaders, setupShader);
+		}
+		else if (path == PATH_INDIRECT)
+		{
+			indirect.clear();
+			for (int i = 0; i < count; i++)
+				indirect.add(poolMesh, models[i], i % 8);
+			indirect.draw(shaders, material, setupShader);
+		}
+		else
+		{
+			Shader* shader = shaders.get(material.features());
+			shader->Use();
+			setupShader(shader);
+			material.apply(shader);
+			glState.bindVertexArray(vao);
+			for (int i = 0; i < count; i++)
+			{
+				shader->setMat4("model", glm::value_ptr(models[i]));
+				glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, 0);
+			}
+		}
+		gpuTimer.end();
+		double submitted = glfwGetTime();
+
+		glfwSwapBuffers(window);
+
+		// O primeiro quadro paga compilao de shader e alocao de buffers
+		if (frame == 0)
+			continue;
+		result.updateMs += (updated - frameStart) * 1000.0;
+		result.submitMs += (submitted - updated) * 1000.0;
+		result.frameMs += (glfwGetTime() - frameStart) * 1000.0;
+		while (gpuTimer.poll())
+		{
+			result.gpuMs += gpuTimer.milliseconds();
+			gpuSamples++;
+		}
+	}
+	// Espera a GPU e recolhe as medies que ainda estavam pendentes
+	glFinish();
+	while (gpuTimer.poll())
+	{
+		result.gpuMs += gpuTimer.milliseconds();
+		gpuSamples++;
+	}
+	gpuTimer.release();
+
+	int measured = std::max(1, frames - 1);
+	result.updateMs /= measured;
+	result.submitMs /= measured;
+	result.frameMs /= measured;
+	result.gpuMs = gpuSamples > 0 ? result.gpuMs / gpuSamples : -1.0;
+	return result;
+}
+
+static void printRow(int count, const char* path, const BenchmarkResult& result)
+{
+	std::cout << std::setw(9) << count << std::setw(12) << path << std::fixed << std::setprecision(3)
+		<< std::setw(12) << result.updateMs << std::setw(12) << result.submitMs
+		<< std::setw(12) << result.gpuMs << std::setw(12) << result.frameMs << std::endl;
+}
+
+void runInstancingBenchmark(GLFWwindow* window, ShaderVariantCache& shaders, const Geometry& cube, const Material& material, int maxCubes)
+{
+	const int MAX_SEPARATE_DRAWS = 100000;
+
+	InstancedRenderer instanced;
+	int mesh = instanced.addMesh(cube, material);
+	GeometryPool pool;
+	pool.init();
+	int poolMesh = pool.add(cube);
+	IndirectRenderer indirect(pool);
+	for (int i = 0; i < 8; i++)
+	{
+		glm::vec3 color((i & 1) ? 1.0f : 0.4f, (i & 2) ? 1.0f : 0.4f, (i & 4) ? 1.0f : 0.4f);
+		instanced.setMaterialColor(i, color);
+		indirect.setMaterialColor(i, color);
+	}
+
+	// Geometria prpria para o caminho de um draw por cubo
+	GeometryBuffers separate = uploadGeometry(cube);
+	GLuint vao = separate.vao;
+
+	glState.enable(GL_DEPTH_TEST, true);
+	// Sem vsync, seno todas as rodadas ficam presas em 16 ms
+	glfwSwapInterval(0);
+
+	std::cout << "Benchmark de instancing (" << glDevice.backendName() << "), mdias em ms por quadro" << std::endl;
+	std::cout << std::setw(9) << "cubos" << std::setw(12) << "caminho" << std::setw(12) << "atualizar"
+		<< std::setw(12) << "submeter" << std::setw(12) << "GPU" << std::setw(12) << "quadro" << std::endl;
+
+	for (int count = 1000; count <= maxCubes && !glfwWindowShouldClose(window); count *= 10)
+	{
+		// Menos quadros nas rodadas grandes, para o benchmark inteiro caber em poucos minutos
+		int frames = std::max(10, std::min(120, 10000000 / count));
+		if (count <= MAX_SEPARATE_DRAWS)
+			printRow(count, "um draw", runRound(window, shaders, instanced, mesh, indirect, poolMesh, vao, cube.indexCount(), material, count, PATH_SEPARATE_DRAWS, frames));
+		printRow(count, "instanced", runRound(window, shaders, instanced, mesh, indirect, poolMesh, vao, cube.indexCount(), material, count, PATH_INSTANCED, frames));
+		printRow(count, "indirect", runRound(window, shaders, instanced, mesh, indirect, poolMesh, vao, cube.indexCount(), material, count, PATH_INDIRECT, frames));
+	}
+
+	separate.release();
+	instanced.release();
+	indirect.release();
+	pool.release();
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "Geometry.h"
+#include "Material.h"
+
+//GLFW (depois da GLAD)
+#include <GLFW/glfw3.h>
+
+// Benchmark de 1K a maxCubes cubos girando (em potncias de 10): compara um
+// draw por cubo (uniform model + glDrawElements), o InstancedRenderer
+// (um glDrawElementsInstanced) e o IndirectRenderer (um comando por cubo
+// num glMultiDrawElementsIndirect). Para cada quantidade mede o tempo de CPU
+// para atualizar as transformaes, o tempo de CPU para submeter os draws,
+// o tempo de GPU (timer query) e o tempo total do quadro, e imprime uma tabela.
+// O caminho de um draw por cubo para em 100K (acima disso leva minutos).
+void runInstancingBenchmark(GLFWwindow* window, ShaderVariantCache& shaders, const Geometry& cube, const Material& material, int maxCubes = 1000000);
@@ -0,0 +1,110 @@
+#include "JobSystem.h"
+
+#include <algorithm>
+
+JobSystem jobSystem;
+
+// A thread est dentro de um bloco de parallelFor (um parallelFor ali dentro roda direto)
+static thread_local bool insideJob = false;
+
+JobSystem::JobSystem() : quit(false), active(false), generation(0), busy(0), job(nullptr), count(0), grain(1), chunks(0), nextChunk(0), pendingChunks(0)
+{
+}
+
+void JobSystem::start(int workers)
+{
+	stop();
+	if (workers < 0)
+		workers = std::max(0, (int)std::thread::hardware_concurrency() - 1);
+	quit = false;
+	for (int i = 0; i < workers; i++)
+		threads.push_back(std::thread(&JobSystem::workerLoop, this));
+}
+
+void JobSystem::stop()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		quit = true;
+	}
+	wake.notify_all();
+	for (std::thread& thread : threads)
+		thread.join();
+	threads.clear();
+}
+
+void JobSystem::runChunks()
+{
+	for (;;)
+	{
+		int chunk = nextChunk.fetch_add(1);
+		if (chunk >= chunks)
+			return;
+		int begin = chunk * grain;
+		insideJob = true;
+		(*job)(begin, std::min(count, begin + grain));
+		insideJob = false;
+		if (pendingChunks.fetch_sub(1) == 1)
+		{
+			// Trava s para no perder o aviso entre o teste e a espera do parallelFor
+			std::lock_guard<std::mutex> lock(mutex);
+			finished.notify_all();
+		}
+	}
+}
+
+void JobSystem::parallelFor(int count, int grain, const RangeJob& job)
+{
+	grain = std::max(1, grain);
+	if (threads.empty() || count <= grain || insideJob)
+	{
+		if (count > 0)
+			job(0, count);
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		this->job = &job;
+		this->count = count;
+		this->grain = grain;
+		chunks = (count + grain - 1) / grain;
+		nextChunk = 0;
+		pendingChunks = chunks;
+		active = true;
+		generation++;
+	}
+	wake.notify_all();
+
+	runChunks();
+
+	// Espera tambm as threads que entraram no trabalho e ainda no saram,
+	// para nenhuma ficar com o ponteiro do job depois do retorno
+	std::unique_lock<std::mutex> lock(mutex);
+	finished.wait(lock, [this] { return pendingChunks == 0 && busy == 0; });
+	active = false;
+	this->job = nullptr;
+}
+
+void JobSystem::workerLoop()
+{
+	unsigned seen = 0;
+	for (;;)
+	{
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			wake.wait(lock, [&] { return quit || (active && generation != seen); });
+			if (quit)
+				return;
+			seen = generation;
+			busy++;
+		}
+
+		runChunks();
+
+		std::lock_guard<std::mutex> lock(mutex);
+		busy--;
+		if (busy == 0)
+			finished.notify_all();
+	}
+}
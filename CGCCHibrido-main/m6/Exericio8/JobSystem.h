@@ -0,0 +1,51 @@
+#pragma once
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+
+// Threads de trabalho fixas para dividir laos grandes (culling, rasterizao
+// de oclusores...). parallelFor() corta o intervalo em blocos, que as threads
+// e a prpria thread que chamou vo pegando at acabar; s retorna quando
+// todos os blocos terminaram. Sem start() tudo roda direto na thread que chamou.
+class JobSystem
+{
+public:
+	typedef std::function<void(int begin, int end)> RangeJob;
+
+	JobSystem();
+	~JobSystem() { stop(); }
+
+	// workers < 0: uma thread a menos que os ncleos (a thread principal tambm trabalha)
+	void start(int workers = -1);
+	void stop();
+	int workerCount() const { return (int)threads.size(); }
+
+	// Chama job(begin, end) para blocos de at 'grain' itens cobrindo [0, count).
+	// Um parallelFor por vez; chamado de dentro de um job, roda tudo ali mesmo.
+	void parallelFor(int count, int grain, const RangeJob& job);
+
+protected:
+	void workerLoop();
+	// Pega e executa blocos do trabalho atual at acabarem
+	void runChunks();
+
+	std::vector<std::thread> threads;
+	std::mutex mutex;
+	std::condition_variable wake, finished;
+	bool quit;
+	bool active; //H um parallelFor em andamento
+	unsigned generation; //Muda a cada parallelFor, para as threads saberem que h trabalho novo
+	int busy; //Threads de trabalho dentro do trabalho atual
+
+	const RangeJob* job;
+	int count, grain, chunks;
+	std::atomic<int> nextChunk;
+	std::atomic<int> pendingChunks;
+};
+
+// Instncia nica usada por toda a aplicao
+extern JobSystem jobSystem;
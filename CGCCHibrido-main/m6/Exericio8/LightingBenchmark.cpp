@@ -0,0 +1,85 @@
+#include "LightingBenchmark.h"
+
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <vector>
+#include <algorithm>
+
+//GLM
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "ClusteredLighting.h"
+
+void runLightingBenchmark(int maxLights)
+{
+	const int FRAMES = 50;
+	maxLights = std::min(maxLights, ClusteredLighting::MAX_LIGHTS);
+
+	ClusteredLighting lighting;
+	lighting.setProjection(glm::radians(45.0f), 1920.0f / 1080.0f, 0.1f, 100.0f, 1920, 1080);
+	glm::mat4 view = glm::lookAt(glm::vec3(0.0f, 5.0f, 0.0f), glm::vec3(0.0f, 5.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+
+	// Luzes de raio 1 a 6 numa faixa  frente da cmera, parte delas fora do frustum
+	std::mt19937 random(1234);
+	std::uniform_real_distribution<float> x(-50.0f, 50.0f), y(0.0f, 10.0f), z(-100.0f, 0.0f), radius(1.0f, 6.0f), channel(0.2f, 1.0f);
+	std::vector<glm::vec4> lights(maxLights);
+	for (glm::vec4& light : lights)
+		light = glm::vec4(x(random), y(random), z(random), radius(random));
+
+	std::cout << "Benchmark de luzes em clusters: " << ClusteredLighting::GRID_X << "x" << ClusteredLighting::GRID_Y << "x" << ClusteredLighting::GRID_Z
+		<< " clusters, SIMD " << ClusteredLighting::simdName() << std::endl;
+	std::cout << std::setw(8) << "luzes" << std::setw(10) << "visiveis" << std::setw(14) << "escalar ms" << std::setw(12) << "SIMD ms"
+		<< std::setw(16) << "SIMD+threads ms" << std::setw(14) << "luz/cluster" << std::setw(12) << "max" << std::setw(12) << "descartes" << std::endl;
+
+	for (int count = 256; count <= maxLights; count *= 2)
+	{
+		lighting.clear();
+		for (int i = 0; i < count; i++)
+			lighting.addLight(glm::vec3(lights[i]), lights[i].w, glm::vec3(channel(random), channel(random), channel(random)));
+
+		struct Case
+		{
+			ClusteredLighting::Mode mode;
+			bool threaded;
+		};
+		const Case cases[] = {
+			{ ClusteredLighting::MODE_SCALAR, false },
+			{ ClusteredLighting::MODE_SIMD, false },
+			{ ClusteredLighting::MODE_SIMD, true }
+		};
+		double ms[3];
+		std::vector<int> reference(ClusteredLighting::CLUSTER_COUNT);
+		bool match = true;
+		for (int c = 0; c < 3; c++)
+		{
+			ms[c] = 0.0;
+			for (int frame = 0; frame < FRAMES; frame++)
+			{
+				lighting.assign(view, cases[c].mode, cases[c].threaded);
+				ms[c] += lighting.frameStats().assignMs;
+			}
+			// Os trs caminhos precisam dar a mesma quantidade de luzes em cada cluster
+			int cluster = 0;
+			for (int cz = 0; cz < ClusteredLighting::GRID_Z; cz++)
+				for (int cy = 0; cy < ClusteredLighting::GRID_Y; cy++)
+					for (int cx = 0; cx < ClusteredLighting::GRID_X; cx++, cluster++)
+					{
+						int lightsInCluster = lighting.clusterLightCount(cx, cy, cz);
+						if (c == 0)
+							reference[cluster] = lightsInCluster;
+						else if (reference[cluster] != lightsInCluster)
+							match = false;
+					}
+		}
+
+		const ClusterStats& stats = lighting.frameStats();
+		std::cout << std::setw(8) << count << std::setw(10) << stats.visibleLights << std::fixed << std::setprecision(4)
+			<< std::setw(14) << ms[0] / FRAMES << std::setw(12) << ms[1] / FRAMES << std::setw(16) << ms[2] / FRAMES
+			<< std::setprecision(2) << std::setw(14) << (double)stats.references / ClusteredLighting::CLUSTER_COUNT
+			<< std::setw(12) << stats.maxPerCluster << std::setw(12) << stats.overflows;
+		if (!match)
+			std::cout << "  (caminhos divergem!)";
+		std::cout << std::endl;
+	}
+}
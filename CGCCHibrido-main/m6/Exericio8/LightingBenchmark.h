@@ -0,0 +1,8 @@
+#pragma once
+
+// Benchmark da distribuio de luzes do ClusteredLighting, de 256 at maxLights
+// luzes pontuais espalhadas num frustum de 1920x1080. Mede o assign() no caminho
+// escalar, no SIMD e no SIMD repartido entre as threads, confere que os trs
+// pem as mesmas luzes nos mesmos clusters e mostra quantas luzes cada cluster
+// recebe em mdia (o que o shader percorre por pixel). No usa a OpenGL.
+void runLightingBenchmark(int maxLights = 4096);
@@ -0,0 +1,46 @@
+#pragma once
+
+//GLM
+#include <glm/glm.hpp>
+
+#include "ShaderVariants.h"
+
+// Propriedades de superfcie de um objeto. A partir delas se escolhe a
+// variante mais barata do uber-shader que atende o material.
+struct Material
+{
+	GLuint texID = 0; //Textura difusa (0 = sem textura)
+	glm::vec3 diffuseColor = glm::vec3(1.0f);
+	float shininess = 32.0f;
+	float opacity = 1.0f; //Abaixo de 1 o objeto vai para a passada de transparentes
+	bool lit = true; //Recebe iluminao de Phong
+	bool useVertexColor = false; //Multiplica pela cor gravada nos vrtices
+
+	bool transparent() const { return opacity < 1.0f; }
+
+	unsigned features() const
+	{
+		unsigned mask = 0;
+		if (texID != 0)
+			mask |= SHADER_TEXTURED;
+		if (lit)
+			mask |= SHADER_LIT;
+		if (useVertexColor)
+			mask |= SHADER_VERTEX_COLOR;
+		return mask;
+	}
+
+	// Envia os uniforms do material para a variante j em uso
+	void apply(Shader* shader) const
+	{
+		shader->setVec3("diffuseColor", diffuseColor.r, diffuseColor.g, diffuseColor.b);
+		shader->setFloat("opacity", opacity);
+		if (lit)
+			shader->setFloat("shininess", shininess);
+		if (texID != 0)
+		{
+			glState.bindTexture(0, GL_TEXTURE_2D, texID);
+			shader->setInt("tex_buffer", 0);
+		}
+	}
+};
@@ -1,28 +0,0 @@
-#include "Mesh.h"
-
-void Mesh::initialize(GLuint VAO, int nVertices, Shader* shader, glm::vec3 position, glm::vec3 scale, float angle, glm::vec3 axis)
-{
-	this->VAO = VAO;
-	this->nVertices = nVertices;
-	this->shader = shader;
-	this->position = position;
-	this->scale = scale;
-	this->angle = angle;
-	this->axis = axis;
-}
-
-void Mesh::update()
-{
-	glm::mat4 model = glm::mat4(1);
-	model = glm::translate(model, position);
-	model = glm::rotate(model, glm::radians(angle), axis);
-	model = glm::scale(model, scale);
-	shader->setMat4("model", glm::value_ptr(model));
-}
-
-void Mesh::draw()
-{
-	glBindVertexArray(VAO);
-	glDrawArrays(GL_TRIANGLES, 0, nVertices);
-	glBindVertexArray(0);
-}
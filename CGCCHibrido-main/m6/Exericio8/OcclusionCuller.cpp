@@ -0,0 +1,304 @@
+#include "OcclusionCuller.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "JobSystem.h"
+#include "Profiler.h"
+
+// AVX2 quando o compilador gera AVX2 (/arch:AVX2 ou -mavx2); seno um pixel por vez
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define CG_OCCLUSION_AVX2 1
+#endif
+
+// Nveis da pirmide: o ltimo tem 2 x 1 pixels
+static const int LEVEL_COUNT = 8;
+// Folga no teste para a caixa de um oclusor no ser escondida pelo prprio oclusor
+static const float DEPTH_BIAS = 1e-5f;
+
+OcclusionCuller::OcclusionCuller() : viewProjection(1.0f)
+{
+	levels.resize(LEVEL_COUNT);
+	for (int i = 0; i < LEVEL_COUNT; i++)
+		levels[i].assign((WIDTH >> i) * (HEIGHT >> i), 1.0f);
+}
+
+const char* OcclusionCuller::simdName()
+{
+#if defined(CG_OCCLUSION_AVX2)
+	return "AVX2";
+#else
+	return "escalar";
+#endif
+}
+
+void OcclusionCuller::beginFrame(const glm::mat4& viewProjection)
+{
+	this->viewProjection = viewProjection;
+	triangles.clear();
+	std::fill(levels[0].begin(), levels[0].end(), 1.0f);
+	stats = OcclusionStats();
+}
+
+void OcclusionCuller::addOccluder(const Geometry& geometry, const glm::mat4& model)
+{
+	addOccluder(geometry.vertices.data(), Geometry::FLOATS_PER_VERTEX, geometry.indices.data(), geometry.indexCount(), model);
+}
+
+void OcclusionCuller::addOccluder(const float* positions, int stride, const unsigned* indices, int indexCount, const glm::mat4& model)
+{
+	// Vrtices transformados uma vez s, depois os tringulos pegam pelos ndices
+	glm::mat4 mvp = viewProjection * model;
+	unsigned vertexCount = 0;
+	for (int i = 0; i < indexCount; i++)
+		vertexCount = std::max(vertexCount, indices[i] + 1);
+	clipVertices.resize(vertexCount);
+	for (unsigned v = 0; v < vertexCount; v++)
+	{
+		const float* p = positions + v * stride;
+		clipVertices[v] = mvp * glm::vec4(p[0], p[1], p[2], 1.0f);
+	}
+
+	for (int i = 0; i + 2 < indexCount; i += 3)
+		setupTriangle(clipVertices[indices[i]], clipVertices[indices[i + 1]], clipVertices[indices[i + 2]]);
+	stats.occluders++;
+	stats.occluderTriangles += indexCount / 3;
+}
+
+float OcclusionCuller::screenSize(const BoundingSphere& worldSphere) const
+{
+	// Numa perspectiva projection * view, a linha de w d a distncia ao longo da viso e
+	// o comprimento da linha de y  o fator de escala vertical da projeo
+	glm::vec4 rowY(viewProjection[0][1], viewProjection[1][1], viewProjection[2][1], viewProjection[3][1]);
+	glm::vec4 rowW(viewProjection[0][3], viewProjection[1][3], viewProjection[2][3], viewProjection[3][3]);
+	float distance = glm::dot(rowW, glm::vec4(worldSphere.center, 1.0f));
+	if (distance <= worldSphere.radius)
+		return 1.0f;
+	// Raio projetado em NDC = raio * escala / distncia; a tela tem 2 de altura em NDC, ento o
+	// dimetro (2 * raio) sobre a altura inteira (2)  esse mesmo valor
+	return std::min(1.0f, worldSphere.radius * glm::length(glm::vec3(rowY)) / distance);
+}
+
+void OcclusionCuller::setupTriangle(const glm::vec4& v0, const glm::vec4& v1, const glm::vec4& v2)
+{
+	// Todos fora do mesmo plano lateral ou alm do far: nada a fazer
+	if ((v0.x > v0.w && v1.x > v1.w && v2.x > v2.w) || (v0.x < -v0.w && v1.x < -v1.w && v2.x < -v2.w)
+		|| (v0.y > v0.w && v1.y > v1.w && v2.y > v2.w) || (v0.y < -v0.w && v1.y < -v1.w && v2.y < -v2.w)
+		|| (v0.z > v0.w && v1.z > v1.w && v2.z > v2.w))
+		return;
+
+	// Recorte s no near (z >= -w); os outros planos so resolvidos pelo limite da tela
+	const glm::vec4 in[3] = { v0, v1, v2 };
+	glm::vec4 out[4];
+	int n = 0;
+	for (int i = 0; i < 3; i++)
+	{
+		const glm::vec4& a = in[i];
+		const glm::vec4& b = in[(i + 1) % 3];
+		float da = a.z + a.w, db = b.z + b.w;
+		if (da >= 0.0f)
+			out[n++] = a;
+		if ((da >= 0.0f) != (db >= 0.0f))
+			out[n++] = a + (b - a) * (da / (da - db));
+	}
+	if (n < 3)
+		return;
+
+	glm::vec3 screen[4];
+	for (int i = 0; i < n; i++)
+	{
+		glm::vec3 ndc = glm::vec3(out[i]) / out[i].w;
+		screen[i] = glm::vec3((ndc.x * 0.5f + 0.5f) * WIDTH, (ndc.y * 0.5f + 0.5f) * HEIGHT, ndc.z * 0.5f + 0.5f);
+	}
+	setupClipped(screen[0], screen[1], screen[2]);
+	if (n == 4)
+		setupClipped(screen[0], screen[2], screen[3]);
+}
+
+void OcclusionCuller::setupClipped(const glm::vec3& s0, const glm::vec3& s1, const glm::vec3& s2)
+{
+	// Anti-horrio na tela (y para cima) = de frente; costas e rea zero ficam de fora
+	float area = (s1.x - s0.x) * (s2.y - s0.y) - (s2.x - s0.x) * (s1.y - s0.y);
+	if (!(area > 0.0f))
+		return;
+
+	float minX = std::min(s0.x, std::min(s1.x, s2.x)), maxX = std::max(s0.x, std::max(s1.x, s2.x));
+	float minY = std::min(s0.y, std::min(s1.y, s2.y)), maxY = std::max(s0.y, std::max(s1.y, s2.y));
+	if (maxX < 0.0f || maxY < 0.0f || minX > WIDTH || minY > HEIGHT)
+		return;
+
+	Triangle t;
+	t.minX = std::max(0, (int)std::floor(minX));
+	t.maxX = std::min(WIDTH - 1, (int)std::floor(maxX));
+	t.minY = std::max(0, (int)std::floor(minY));
+	t.maxY = std::min(HEIGHT - 1, (int)std::floor(maxY));
+
+	// Aresta p -> q: o interior fica  esquerda
+	const glm::vec3* v[3] = { &s0, &s1, &s2 };
+	for (int e = 0; e < 3; e++)
+	{
+		const glm::vec3& p = *v[e];
+		const glm::vec3& q = *v[(e + 1) % 3];
+		t.edgeA[e] = p.y - q.y;
+		t.edgeB[e] = q.x - p.x;
+		t.edgeC[e] = -(t.edgeA[e] * p.x + t.edgeB[e] * p.y);
+	}
+
+	// Plano da profundidade na tela (z/w varia linearmente em x e y)
+	float dx1 = s1.x - s0.x, dy1 = s1.y - s0.y, dz1 = s1.z - s0.z;
+	float dx2 = s2.x - s0.x, dy2 = s2.y - s0.y, dz2 = s2.z - s0.z;
+	t.zA = (dz1 * dy2 - dy1 * dz2) / area;
+	t.zB = (dx1 * dz2 - dz1 * dx2) / area;
+	t.zC = s0.z - t.zA * s0.x - t.zB * s0.y;
+	triangles.push_back(t);
+}
+
+void OcclusionCuller::rasterize(bool threaded)
+{
+	PROFILE_ZONE("OcclusionCuller::rasterize");
+	stats.rasterizedTriangles = (int)triangles.size();
+	const int bands = HEIGHT / BAND_HEIGHT;
+	if (threaded)
+		jobSystem.parallelFor(bands, 1, [this](int begin, int end) {
+			for (int band = begin; band < end; band++)
+				rasterizeBand(band);
+		});
+	else
+		for (int band = 0; band < bands; band++)
+			rasterizeBand(band);
+	buildPyramid();
+}
+
+void OcclusionCuller::rasterizeBand(int band)
+{
+	const int bandMinY = band * BAND_HEIGHT;
+	const int bandMaxY = bandMinY + BAND_HEIGHT - 1;
+	float* depth = levels[0].data();
+
+	for (const Triangle& t : triangles)
+	{
+		if (t.maxY < bandMinY || t.minY > bandMaxY)
+			continue;
+		int y0 = std::max(t.minY, bandMinY), y1 = std::min(t.maxY, bandMaxY);
+
+#if defined(CG_OCCLUSION_AVX2)
+		// 8 pixels por vez a partir de um x mltiplo de 8 (WIDTH tambm )
+		const __m256 lane = _mm256_setr_ps(0.5f, 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f, 7.5f);
+		const __m256 zero = _mm256_setzero_ps();
+		const __m256 a0 = _mm256_set1_ps(t.edgeA[0]), a1 = _mm256_set1_ps(t.edgeA[1]), a2 = _mm256_set1_ps(t.edgeA[2]);
+		const __m256 zA = _mm256_set1_ps(t.zA);
+		const int x0 = t.minX & ~7;
+		for (int y = y0; y <= y1; y++)
+		{
+			float fy = y + 0.5f;
+			__m256 row0 = _mm256_set1_ps(t.edgeB[0] * fy + t.edgeC[0]);
+			__m256 row1 = _mm256_set1_ps(t.edgeB[1] * fy + t.edgeC[1]);
+			__m256 row2 = _mm256_set1_ps(t.edgeB[2] * fy + t.edgeC[2]);
+			__m256 rowZ = _mm256_set1_ps(t.zB * fy + t.zC);
+			float* line = depth + y * WIDTH;
+			for (int x = x0; x <= t.maxX; x += 8)
+			{
+				__m256 px = _mm256_add_ps(_mm256_set1_ps((float)x), lane);
+				__m256 inside = _mm256_cmp_ps(_mm256_add_ps(_mm256_mul_ps(a0, px), row0), zero, _CMP_GE_OQ);
+				inside = _mm256_and_ps(inside, _mm256_cmp_ps(_mm256_add_ps(_mm256_mul_ps(a1, px), row1), zero, _CMP_GE_OQ));
+				inside = _mm256_and_ps(inside, _mm256_cmp_ps(_mm256_add_ps(_mm256_mul_ps(a2, px), row2), zero, _CMP_GE_OQ));
+				if (_mm256_testz_ps(inside, inside))
+					continue;
+				__m256 z = _mm256_add_ps(_mm256_mul_ps(zA, px), rowZ);
+				__m256 old = _mm256_loadu_ps(line + x);
+				_mm256_storeu_ps(line + x, _mm256_blendv_ps(old, _mm256_min_ps(old, z), inside));
+			}
+		}
+#else
+		for (int y = y0; y <= y1; y++)
+		{
+			float fy = y + 0.5f;
+			float* line = depth + y * WIDTH;
+			for (int x = t.minX; x <= t.maxX; x++)
+			{
+				float fx = x + 0.5f;
+				if (t.edgeA[0] * fx + t.edgeB[0] * fy + t.edgeC[0] < 0.0f || t.edgeA[1] * fx + t.edgeB[1] * fy + t.edgeC[1] < 0.0f
+					|| t.edgeA[2] * fx + t.edgeB[2] * fy + t.edgeC[2] < 0.0f)
+					continue;
+				line[x] = std::min(line[x], t.zA * fx + t.zB * fy + t.zC);
+			}
+		}
+#endif
+	}
+}
+
+void OcclusionCuller::buildPyramid()
+{
+	// Cada pixel do nvel de cima guarda a profundidade mais distante dos 4 de baixo
+	for (int level = 1; level < LEVEL_COUNT; level++)
+	{
+		const std::vector<float>& below = levels[level - 1];
+		std::vector<float>& above = levels[level];
+		int belowWidth = WIDTH >> (level - 1);
+		int width = WIDTH >> level, height = HEIGHT >> level;
+		for (int y = 0; y < height; y++)
+			for (int x = 0; x < width; x++)
+			{
+				const float* p = &below[(2 * y) * belowWidth + 2 * x];
+				above[y * width + x] = std::max(std::max(p[0], p[1]), std::max(p[belowWidth], p[belowWidth + 1]));
+			}
+	}
+}
+
+bool OcclusionCuller::visible(const AABB& worldBox)
+{
+	stats.tested++;
+	if (testBox(worldBox))
+		return true;
+	stats.occluded++;
+	return false;
+}
+
+void OcclusionCuller::countTests(int tested, int occluded)
+{
+	stats.tested += tested;
+	stats.occluded += occluded;
+}
+
+bool OcclusionCuller::testBox(const AABB& worldBox) const
+{
+	// Retngulo na tela e profundidade mais prxima dos 8 cantos
+	float minX = 1e30f, maxX = -1e30f, minY = 1e30f, maxY = -1e30f, nearest = 1e30f;
+	for (int i = 0; i < 8; i++)
+	{
+		glm::vec3 corner((i & 1) ? worldBox.max.x : worldBox.min.x, (i & 2) ? worldBox.max.y : worldBox.min.y, (i & 4) ? worldBox.max.z : worldBox.min.z);
+		glm::vec4 clip = viewProjection * glm::vec4(corner, 1.0f);
+		// Caixa cruzando o near (ou atrs da cmera): no d para projetar, fica visvel
+		if (clip.z < -clip.w || clip.w <= 0.0f)
+			return true;
+		glm::vec3 ndc = glm::vec3(clip) / clip.w;
+		float x = (ndc.x * 0.5f + 0.5f) * WIDTH, y = (ndc.y * 0.5f + 0.5f) * HEIGHT;
+		minX = std::min(minX, x);
+		maxX = std::max(maxX, x);
+		minY = std::min(minY, y);
+		maxY = std::max(maxY, y);
+		nearest = std::min(nearest, ndc.z * 0.5f + 0.5f);
+	}
+	// Fora da tela  assunto do frustum culling
+	if (maxX < 0.0f || maxY < 0.0f || minX >= WIDTH || minY >= HEIGHT)
+		return true;
+
+	// Todos os pixels que o retngulo toca, mesmo em parte
+	int x0 = std::max(0, (int)std::floor(minX)), x1 = std::min(WIDTH - 1, (int)std::floor(maxX));
+	int y0 = std::max(0, (int)std::floor(minY)), y1 = std::min(HEIGHT - 1, (int)std::floor(maxY));
+
+	// Nvel em que o retngulo cobre no mximo 2 x 2 pixels
+	int level = 0;
+	while (level < LEVEL_COUNT - 1 && ((x1 >> level) - (x0 >> level) > 1 || (y1 >> level) - (y0 >> level) > 1))
+		level++;
+
+	const std::vector<float>& hiz = levels[level];
+	int width = WIDTH >> level;
+	nearest -= DEPTH_BIAS;
+	for (int y = y0 >> level; y <= (y1 >> level); y++)
+		for (int x = x0 >> level; x <= (x1 >> level); x++)
+			if (hiz[y * width + x] >= nearest)
+				return true;
+	return false;
+}
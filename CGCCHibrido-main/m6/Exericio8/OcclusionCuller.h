@@ -0,0 +1,96 @@
+#pragma once
+
+#include <vector>
+
+//GLM
+#include <glm/glm.hpp>
+
+#include "Bounds.h"
+#include "Geometry.h"
+
+// Estatsticas de um quadro do OcclusionCuller
+struct OcclusionStats
+{
+	int occluders = 0; //Malhas recebidas em addOccluder
+	int occluderTriangles = 0; //Tringulos recebidos
+	int rasterizedTriangles = 0; //Os que sobraram depois de costas, recorte e rea zero
+	int tested = 0;
+	int occluded = 0;
+};
+
+// Culling por ocluso na CPU: os oclusores escolhidos (paredes, prdios...) so
+// rasterizados num depth buffer pequeno (WIDTH x HEIGHT) e as caixas dos objetos
+// so testadas contra uma pirmide hierrquica (HiZ) desse buffer antes de irem
+// para a fila de desenho. No usa a GPU.
+//
+// A rasterizao  por equaes de aresta, 8 pixels por vez com AVX2 (escalar
+// sem AVX2), e a tela  dividida em faixas horizontais repartidas entre as
+// threads do jobSystem, cada uma passando por todos os tringulos que tocam a sua
+// faixa (sem travas: nenhuma faixa escreve na outra).
+//
+// Profundidade em [0, 1] (0 = perto). O buffer guarda a mais prxima de cada
+// pixel e cada nvel da pirmide a mais distante dos 4 pixels de baixo; uma caixa
+// est escondida se o ponto mais prximo dela est atrs de tudo que cobre o
+// retngulo dela na tela.
+class OcclusionCuller
+{
+public:
+	static const int WIDTH = 256;
+	static const int HEIGHT = 128;
+	// Linhas por faixa da rasterizao paralela
+	static const int BAND_HEIGHT = 8;
+	// Oclusores cujo dimetro na tela  menor que 10% da altura inteira (pelo screenSize)
+	// no valem os vrtices transformados e tringulos rasterizados: quase nada fica atrs deles
+	static constexpr float MIN_OCCLUDER_SIZE = 0.1f;
+
+	OcclusionCuller();
+
+	// Limpa o buffer e guarda a matriz do quadro (projection * view)
+	void beginFrame(const glm::mat4& viewProjection);
+	// Posies com 'stride' floats entre um vrtice e o prximo; tringulos no sentido anti-horrio
+	void addOccluder(const float* positions, int stride, const unsigned* indices, int indexCount, const glm::mat4& model);
+	void addOccluder(const Geometry& geometry, const glm::mat4& model);
+	// Dimetro da esfera (no mundo) projetada com a matriz do quadro, como frao da altura
+	// inteira da tela (o mesmo que o raio sobre meia altura); 1 se a cmera est dentro dela
+	float screenSize(const BoundingSphere& worldSphere) const;
+	// Rasteriza os oclusores adicionados e monta a pirmide. Chamar antes dos testes.
+	void rasterize(bool threaded = true);
+
+	// true se a caixa (no mundo) pode aparecer; false se est atrs dos oclusores
+	bool visible(const AABB& worldBox);
+	// O mesmo teste sem mexer nas estatsticas, para chamar de vrias threads;
+	// quem chama soma o que testou com countTests() depois
+	bool testBox(const AABB& worldBox) const;
+	void countTests(int tested, int occluded);
+
+	const OcclusionStats& frameStats() const { return stats; }
+	// Profundidade do nvel 0, linha 0 embaixo (para depurao)
+	const float* depthBuffer() const { return levels[0].data(); }
+
+	// Nome do caminho compilado ("AVX2" ou "escalar")
+	static const char* simdName();
+
+protected:
+	// Tringulo j em pixels, com as arestas e o plano de profundidade prontos
+	struct Triangle
+	{
+		int minX, maxX, minY, maxY;
+		// Aresta i: a*x + b*y + c >= 0 dentro
+		float edgeA[3], edgeB[3], edgeC[3];
+		// z = zA*x + zB*y + zC
+		float zA, zB, zC;
+	};
+
+	// Recorta no plano near e monta os tringulos na tela
+	void setupTriangle(const glm::vec4& v0, const glm::vec4& v1, const glm::vec4& v2);
+	void setupClipped(const glm::vec3& s0, const glm::vec3& s1, const glm::vec3& s2);
+	void rasterizeBand(int band);
+	void buildPyramid();
+
+	glm::mat4 viewProjection;
+	std::vector<glm::vec4> clipVertices;
+	std::vector<Triangle> triangles;
+	// Nvel 0 = buffer de profundidade; nvel i tem (WIDTH >> i) x (HEIGHT >> i)
+	std::vector<std::vector<float>> levels;
+	OcclusionStats stats;
+};
@@ -0,0 +1,65 @@
+#include "OffscreenTarget.h"
+
+#include <vector>
+#include <fstream>
+#include <iostream>
+
+#include "GLDevice.h"
+#include "GLState.h"
+
+OffscreenTarget::OffscreenTarget() : framebuffer(0), colorTexture(0), depthTexture(0), width(0), height(0)
+{
+}
+
+OffscreenTarget::~OffscreenTarget()
+{
+	release();
+}
+
+bool OffscreenTarget::init(int width, int height)
+{
+	release();
+	this->width = width;
+	this->height = height;
+	colorTexture = glDevice.createTexture2D(GL_RGBA8, width, height, 1);
+	depthTexture = glDevice.createTexture2D(GL_DEPTH24_STENCIL8, width, height, 1);
+	framebuffer = glDevice.createFramebuffer({ colorTexture }, depthTexture, GL_DEPTH_STENCIL_ATTACHMENT);
+	if (framebuffer == 0)
+	{
+		std::cout << "OffscreenTarget: framebuffer incompleto" << std::endl;
+		release();
+		return false;
+	}
+	return true;
+}
+
+void OffscreenTarget::release()
+{
+	if (framebuffer != 0)
+		glState.deleteFramebuffer(framebuffer);
+	if (colorTexture != 0)
+		glState.deleteTexture(colorTexture);
+	if (depthTexture != 0)
+		glState.deleteTexture(depthTexture);
+	framebuffer = colorTexture = depthTexture = 0;
+}
+
+bool writeFramebufferPPM(const std::string& path, GLuint framebuffer, int width, int height)
+{
+	std::vector<unsigned char> pixels((size_t)width * height * 3);
+	glState.bindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+	glPixelStorei(GL_PACK_ALIGNMENT, 1);
+	glReadPixels(0, 0, width, height, GL_RGB, GL_UNSIGNED_BYTE, pixels.data());
+
+	std::ofstream file(path.c_str(), std::ios::binary);
+	if (!file)
+	{
+		std::cout << "Nao foi possivel gravar " << path << std::endl;
+		return false;
+	}
+	file << "P6\n" << width << " " << height << "\n255\n";
+	// A OpenGL l de baixo para cima
+	for (int y = height - 1; y >= 0; y--)
+		file.write((const char*)&pixels[(size_t)y * width * 3], (std::streamsize)width * 3);
+	return true;
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <string>
+
+//GLAD
+#include <glad/glad.h>
+
+// Framebuffer no lugar da tela para o modo sem janela: cor RGBA8 e
+// profundidade D24S8 (o mesmo formato do G-buffer, para o glBlitFramebuffer
+// do DeferredRenderer). Com glState.setScreenFramebuffer() quem "volta para a
+// tela" volta para ele.
+class OffscreenTarget
+{
+public:
+	OffscreenTarget();
+	~OffscreenTarget();
+
+	bool init(int width, int height);
+	void release();
+	bool ready() const { return framebuffer != 0; }
+
+	GLuint target() const { return framebuffer; }
+	int getWidth() const { return width; }
+	int getHeight() const { return height; }
+
+protected:
+	GLuint framebuffer;
+	GLuint colorTexture, depthTexture;
+	int width, height;
+};
+
+// Grava a cor de 'framebuffer' (0 = tela) num PPM binrio (P6), de cima para baixo
+bool writeFramebufferPPM(const std::string& path, GLuint framebuffer, int width, int height);
@@ -1,5 +1,6 @@
 #include <iostream>
 #include <string>
+#include <cstring>
 #include <assert.h>
 
 // GLAD
@@ -13,106 +14,299 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 #include <vector>
+#include <random>
+#include <algorithm>
+#include <cmath>
 #include <fstream>
 #include <sstream>
 #define STB_IMAGE_IMPLEMENTATION
 #include "../Exericio8/stb_image.h"
+
+#include "GLState.h"
+#include "GLDevice.h"
+#include "ShaderPreprocessor.h"
+#include "ShaderVariants.h"
+#include "ShaderHotReload.h"
+#include "Profiler.h"
+#include "Material.h"
+#include "Geometry.h"
+#include "RenderQueue.h"
+#include "StreamBuffer.h"
+#include "FrustumCuller.h"
+#include "OcclusionCuller.h"
+#include "JobSystem.h"
+#include "CullingBenchmark.h"
+#include "TransformHierarchy.h"
+#include "ECS.h"
+#include "SystemScheduler.h"
+#include "SceneSystems.h"
+#include "ClusteredLighting.h"
+#include "DeferredRenderer.h"
+#include "CascadedShadows.h"
+#include "LightingBenchmark.h"
+#include "TransformBenchmark.h"
+#include "InstancingBenchmark.h"
+#include "CommandListBenchmark.h"
+#include "FrameScheduler.h"
+#include "HeadlessContext.h"
+#include "OffscreenTarget.h"
+#include "CameraPath.h"
+#include "FrameBenchmark.h"
+#include "InputSystem.h"
+#include "FrameCapture.h"
+#include "DynamicResolution.h"
+#include "GpuQuery.h"
 using namespace std;
 
-// Prottipo da funo de callback de teclado
+// Prottipo da funo de callback de teclado (s pe o evento na fila do inputSystem)
 void key_callback(GLFWwindow* window, int key, int scancode, int action, int mode);
 
 int carregarTextura(string caminho);
 
 // Prottipos das funes
-int setupShader();
-void processInput(glm::vec3& position, glm::vec3& scale);
+void processInput(float dt, glm::vec3& translation, float& scaleFactor);
 
 // Dimenses da janela (pode ser alterado em tempo de execuo)
 const GLuint WIDTH = 2000, HEIGHT = 1400;
 
-// Cdigo fonte do Vertex Shader (em GLSL): ainda hardcoded
-const GLchar* vertexShaderSource = "#version 450\n"
-"layout (location = 0) in vec3 position;\n"
-"layout (location = 1) in vec3 color;\n"
-"layout(location = 2) in vec2 tex_coord;\n"
-"layout (location = 3) in vec3 normal;\n"
-"uniform mat4 model;\n"
-"uniform mat4 view;\n"
-"uniform mat4 projection;\n"
-"out vec3 FragPos;\n"
-"out vec3 Normal;\n"
-"out vec4 finalColor;\n"
-"out vec2 texCoord;\n"
-"void main()\n"
-"{\n"
-"    FragPos = vec3(model * vec4(position, 1.0));\n"
-"    Normal = mat3(transpose(inverse(model))) * normal;\n"
-"    gl_Position = projection * view * model * vec4(position, 1.0);\n"
-"    finalColor = vec4(color, 1.0);\n"
-"    texCoord = vec2(tex_coord.x, 1 - tex_coord.y);\n"
-"}\0";
-
-// Cdigo fonte do Fragment Shader (em GLSL): ainda hardcoded
-const GLchar* fragmentShaderSource = "#version 450\n"
-"in vec3 FragPos;\n"
-"in vec3 Normal;\n"
-"in vec4 finalColor;\n"
-"in vec2 texCoord;\n"
-"out vec4 color;\n"
-"uniform sampler2D tex_buffer;\n"
-"uniform vec3 lightPos;\n"
-"uniform vec3 viewPos;\n"
-"uniform vec3 lightColor;\n"
-"uniform float shininess;\n"
-"void main()\n"
-"{\n"
-"    vec3 ambient = 0.1 * lightColor;\n"
-"    vec3 norm = normalize(Normal);\n"
-"    vec3 lightDir = normalize(lightPos - FragPos);\n"
-"    float diff = max(dot(norm, lightDir), 0.0);\n"
-"    vec3 diffuse = diff * lightColor;\n"
-"    vec3 viewDir = normalize(viewPos - FragPos);\n"
-"    vec3 reflectDir = reflect(-lightDir, norm);\n"
-"    float spec = pow(max(dot(viewDir, reflectDir), 0.0), shininess);\n"
-"    vec3 specular = spec * lightColor;\n"
-"    vec3 result = ambient + diffuse + specular;\n"
-"    vec4 texColor = texture(tex_buffer, texCoord);\n"
-"    color = vec4(result, 1.0) * texColor;\n"
-"}\0";
-
-bool rotateX = false, rotateY = false, rotateZ = false;
-bool moveXPos = false, moveXNeg = false;
-bool moveYPos = false, moveYNeg = false;
-bool moveZPos = false, moveZNeg = false;
-bool scaleUp = false, scaleDown = false;
-
-int loadSimpleOBJ(string filepath, int& nVerts, glm::vec3 color = glm::vec3(1.0, 0.0, 1.0));
-
-int main()
+int main(int argc, char** argv)
 {
-    // Inicializao da GLFW
-    if (!glfwInit())
+    // --gl33 fora o caminho antigo (bind para editar) mesmo num contexto 4.5
+    // --bench-instancing [max] roda o benchmark de instancing (1K at max cubos) e sai
+    // --queue-stats mostra as trocas de estado que a ordenao da fila de desenho evitou
+    // --bench-culling [n] roda o benchmark de frustum culling (n objetos, sem janela) e sai
+    // --bench-occlusion [n] roda o benchmark de ocluso na CPU (n objetos, sem janela) e sai
+    // --bench-transforms [n] roda o benchmark da hierarquia de transformaes (n ns, sem janela) e sai
+    // --bench-commands [n] compara a gravao de comandos na thread do GL e em paralelo (n objetos) e sai
+    // --bench-lights [max] roda o benchmark da distribuio de luzes em clusters (at max luzes, sem janela) e sai
+    // --occlusion testa os objetos contra os oclusores rasterizados na CPU antes de desenhar
+    // --lights [n] acrescenta n luzes pontuais girando com os cubos (iluminao em clusters)
+    // --deferred comea no caminho deferred (G-buffer e passo de luz de tela cheia) em vez do forward
+    // --shadows liga as sombras em cascata da luz principal e pe um cho esttico para receb-las
+    // --prepass on|off|auto controla o pr-passo de profundidade dos opacos (auto = conforme o overdraw medido)
+    // --swap-interval n espera n retraos da tela a cada troca de buffers (0 = sem vsync; padro 1, 0 no --benchmark)
+    // --fps-limit n segura os quadros em at n por segundo (til com --swap-interval 0)
+    // --sim-rate n passos fixos da simulao por segundo (padro 120)
+    // --headless desenha sem janela (EGL/OSMesa, serve o llvmpipe) num framebuffer WIDTH x HEIGHT,
+    //   com a simulao andando 1/60 s por quadro para o resultado ser reproduzvel
+    // --frames n para depois de n quadros (padro 60 com --headless)
+    // --output arquivo.ppm grava a imagem do ltimo dos --frames quadros
+    // --benchmark <cena> <caminho> percorre um caminho de cmera gravado (CameraPath, com os eventos
+    //   de teclado), com 1/60 s de simulao por quadro, e grava mdia e percentis dos tempos de
+    //   quadro, CPU e GPU em JSON. Cenas: cubos, luzes, deferred, sombras, completa.
+    //   Mede --frames quadros (padro: a durao do caminho a 60 quadros por segundo). Sem vsync e
+    //   sem limite de quadros, a no ser com --swap-interval ou --fps-limit explcitos, para o tempo
+    //   medido no ficar preso aos 16,7 ms do retrao.
+    // --benchmark-json arquivo onde o relatrio do --benchmark  gravado (padro benchmark.json)
+    // --record-input arquivo grava o teclado e o tempo de cada quadro (InputSystem)
+    // --replay-input arquivo repete uma sesso gravada quadro a quadro no lugar do teclado
+    // --capture arquivo grava todos os quadros sem parar o desenho (FrameCapture): nome.png vira
+    //   nome_000001.png, nome_000002.png...; .y4m  um vdeo e .raw os quadros RGB em sequncia
+    // --dynamic-resolution [ms] desenha a cena numa frao da tela (entre 50% e 100% de cada lado),
+    //   ajustada pelo tempo de GPU medido para ficar em ms por quadro (padro 16.6), e amplia para a tela
+    bool forceLegacy = false;
+    bool queueStats = false;
+    int benchmarkCubes = 0;
+    int benchmarkCulling = 0;
+    int benchmarkOcclusion = 0;
+    int benchmarkTransforms = 0;
+    int benchmarkCommands = 0;
+    int benchmarkLights = 0;
+    bool occlusionCulling = false;
+    int pointLights = 0;
+    bool shadows = false;
+    // Tecla G alterna entre forward e deferred
+    bool deferredShading = false;
+    DepthPrepassMode prepassMode = PREPASS_AUTO;
+    int swapInterval = -1; //-1 = padro (conforme o modo)
+    double fpsLimit = 0.0;
+    double simulationRate = 120.0;
+    bool headless = false;
+    int frameCount = 0;
+    std::string outputPath;
+    std::string benchmarkScene, benchmarkPath;
+    std::string benchmarkJson = "benchmark.json";
+    std::string recordInput, replayInput;
+    std::string capturePath;
+    double dynamicResolutionMs = 0.0;
+    for (int i = 1; i < argc; i++)
     {
-        std::cerr << "Failed to initialize GLFW" << std::endl;
-        return -1;
+        if (strcmp(argv[i], "--gl33") == 0)
+            forceLegacy = true;
+        else if (strcmp(argv[i], "--bench-instancing") == 0)
+            benchmarkCubes = (i + 1 < argc && argv[i + 1][0] != '-') ? atoi(argv[++i]) : 1000000;
+        else if (strcmp(argv[i], "--queue-stats") == 0)
+            queueStats = true;
+        else if (strcmp(argv[i], "--bench-culling") == 0)
+            benchmarkCulling = (i + 1 < argc && argv[i + 1][0] != '-') ? atoi(argv[++i]) : 100000;
+        else if (strcmp(argv[i], "--bench-occlusion") == 0)
+            benchmarkOcclusion = (i + 1 < argc && argv[i + 1][0] != '-') ? atoi(argv[++i]) : 100000;
+        else if (strcmp(argv[i], "--bench-transforms") == 0)
+            benchmarkTransforms = (i + 1 < argc && argv[i + 1][0] != '-') ? atoi(argv[++i]) : 100000;
+        else if (strcmp(argv[i], "--bench-commands") == 0)
+            benchmarkCommands = (i + 1 < argc && argv[i + 1][0] != '-') ? atoi(argv[++i]) : 20000;
+        else if (strcmp(argv[i], "--bench-lights") == 0)
+            benchmarkLights = (i + 1 < argc && argv[i + 1][0] != '-') ? atoi(argv[++i]) : 4096;
+        else if (strcmp(argv[i], "--occlusion") == 0)
+            occlusionCulling = true;
+        else if (strcmp(argv[i], "--lights") == 0)
+            pointLights = (i + 1 < argc && argv[i + 1][0] != '-') ? atoi(argv[++i]) : 512;
+        else if (strcmp(argv[i], "--deferred") == 0)
+            deferredShading = true;
+        else if (strcmp(argv[i], "--shadows") == 0)
+            shadows = true;
+        else if (strcmp(argv[i], "--prepass") == 0 && i + 1 < argc)
+        {
+            i++;
+            prepassMode = strcmp(argv[i], "on") == 0 ? PREPASS_ON : strcmp(argv[i], "off") == 0 ? PREPASS_OFF : PREPASS_AUTO;
+        }
+        else if (strcmp(argv[i], "--swap-interval") == 0 && i + 1 < argc)
+            swapInterval = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--fps-limit") == 0 && i + 1 < argc)
+            fpsLimit = atof(argv[++i]);
+        else if (strcmp(argv[i], "--sim-rate") == 0 && i + 1 < argc)
+            simulationRate = std::max(1.0, atof(argv[++i]));
+        else if (strcmp(argv[i], "--headless") == 0)
+            headless = true;
+        else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+            frameCount = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--output") == 0 && i + 1 < argc)
+            outputPath = argv[++i];
+        else if (strcmp(argv[i], "--benchmark") == 0 && i + 2 < argc)
+        {
+            benchmarkScene = argv[++i];
+            benchmarkPath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--benchmark-json") == 0 && i + 1 < argc)
+            benchmarkJson = argv[++i];
+        else if (strcmp(argv[i], "--record-input") == 0 && i + 1 < argc)
+            recordInput = argv[++i];
+        else if (strcmp(argv[i], "--replay-input") == 0 && i + 1 < argc)
+            replayInput = argv[++i];
+        else if (strcmp(argv[i], "--capture") == 0 && i + 1 < argc)
+            capturePath = argv[++i];
+        else if (strcmp(argv[i], "--dynamic-resolution") == 0)
+            dynamicResolutionMs = (i + 1 < argc && argv[i + 1][0] != '-') ? atof(argv[++i]) : 16.6;
     }
 
-    // Criao da janela GLFW
-    GLFWwindow* window = glfwCreateWindow(WIDTH, HEIGHT, "Ola 3D -- Marcelo Luiz Fontana!", nullptr, nullptr);
-    if (!window)
+    // Cenas do --benchmark: combinaes fixas das opes acima
+    bool benchmark = !benchmarkScene.empty();
+    CameraPath cameraPath;
+    if (benchmark)
     {
-        std::cerr << "Failed to create GLFW window" << std::endl;
-        glfwTerminate();
+        if (benchmarkScene == "luzes")
+            pointLights = 1024;
+        else if (benchmarkScene == "deferred")
+        {
+            pointLights = 1024;
+            deferredShading = true;
+        }
+        else if (benchmarkScene == "sombras")
+            shadows = true;
+        else if (benchmarkScene == "completa")
+        {
+            pointLights = 1024;
+            deferredShading = true;
+            shadows = true;
+        }
+        else if (benchmarkScene != "cubos")
+        {
+            std::cout << "Cena de benchmark desconhecida: " << benchmarkScene << " (cubos, luzes, deferred, sombras, completa)" << std::endl;
+            return -1;
+        }
+        if (!cameraPath.load(benchmarkPath))
+            return -1;
+        // Sem vsync, a no ser que tenha sido pedido (o --fps-limit j s vale se for explcito)
+        if (swapInterval < 0)
+            swapInterval = 0;
+        int measured = frameCount > 0 ? frameCount : (int)std::ceil(cameraPath.duration() * 60.0f) + 1;
+        frameCount = FrameBenchmark::WARMUP_FRAMES + measured;
+    }
+    if (headless && frameCount <= 0)
+        frameCount = 60;
+
+    // Teclas das aes (os eventos chegam pelo key_callback)
+    inputSystem.bind(GLFW_KEY_ESCAPE, ACTION_QUIT);
+    inputSystem.bind(GLFW_KEY_G, ACTION_TOGGLE_DEFERRED);
+    inputSystem.bind(GLFW_KEY_A, ACTION_MOVE_LEFT);
+    inputSystem.bind(GLFW_KEY_D, ACTION_MOVE_RIGHT);
+    inputSystem.bind(GLFW_KEY_W, ACTION_MOVE_UP);
+    inputSystem.bind(GLFW_KEY_S, ACTION_MOVE_DOWN);
+    inputSystem.bind(GLFW_KEY_I, ACTION_MOVE_FORWARD);
+    inputSystem.bind(GLFW_KEY_J, ACTION_MOVE_BACK);
+    inputSystem.bind(GLFW_KEY_U, ACTION_SCALE_UP);
+    inputSystem.bind(GLFW_KEY_P, ACTION_SCALE_DOWN);
+    inputSystem.bind(GLFW_KEY_SPACE, ACTION_PICK);
+    if (!replayInput.empty() && !inputSystem.startReplay(replayInput))
+        return -1;
+    if (!recordInput.empty() && replayInput.empty() && !inputSystem.startRecording(recordInput))
         return -1;
+
+    // Threads de trabalho para culling e afins
+    jobSystem.start();
+    if (benchmarkCulling > 0 || benchmarkOcclusion > 0 || benchmarkTransforms > 0 || benchmarkLights > 0)
+    {
+        if (benchmarkCulling > 0)
+            runCullingBenchmark(benchmarkCulling);
+        if (benchmarkOcclusion > 0)
+            runOcclusionBenchmark(benchmarkOcclusion);
+        if (benchmarkTransforms > 0)
+            runTransformBenchmark(benchmarkTransforms);
+        if (benchmarkLights > 0)
+            runLightingBenchmark(benchmarkLights);
+        jobSystem.stop();
+        return 0;
+    }
+
+    // Sem janela o contexto vem do HeadlessContext (e s existe janela, escondida, no backend da GLFW)
+    GLFWwindow* window = nullptr;
+    HeadlessContext headlessContext;
+    if (headless)
+    {
+        if (!headlessContext.create())
+        {
+            std::cerr << "Failed to create headless context" << std::endl;
+            return -1;
+        }
+        window = headlessContext.window();
+        std::cout << "Sem janela: " << headlessContext.backend() << std::endl;
     }
-    glfwMakeContextCurrent(window);
+    else
+    {
+        // Inicializao da GLFW
+        if (!glfwInit())
+        {
+            std::cerr << "Failed to initialize GLFW" << std::endl;
+            return -1;
+        }
 
-    // Fazendo o registro da funo de callback para a janela GLFW
-    glfwSetKeyCallback(window, key_callback);
+        // Criao da janela GLFW: pede um contexto 4.5 core e, se o driver no tiver, um 3.3 core
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 5);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+        window = glfwCreateWindow(WIDTH, HEIGHT, "Ola 3D -- Marcelo Luiz Fontana!", nullptr, nullptr);
+        if (!window)
+        {
+            glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+            glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+            window = glfwCreateWindow(WIDTH, HEIGHT, "Ola 3D -- Marcelo Luiz Fontana!", nullptr, nullptr);
+        }
+        if (!window)
+        {
+            std::cerr << "Failed to create GLFW window" << std::endl;
+            glfwTerminate();
+            return -1;
+        }
+        glfwMakeContextCurrent(window);
+
+        // Fazendo o registro da funo de callback para a janela GLFW
+        glfwSetKeyCallback(window, key_callback);
+        // Retraos da tela por troca de buffers (vsync)
+        glfwSwapInterval(swapInterval < 0 ? 1 : swapInterval);
+    }
 
     // GLAD: carrega todos os ponteiros de funes da OpenGL
-    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+    if (!gladLoadGLLoader(headless ? (GLADloadproc)HeadlessContext::getProcAddress : (GLADloadproc)glfwGetProcAddress))
     {
         std::cout << "Failed to initialize GLAD" << std::endl;
         return -1;
@@ -124,373 +318,560 @@ int main()
     std::cout << "Renderer: " << renderer << std::endl;
     std::cout << "OpenGL version supported " << version << std::endl;
 
+    // Escolhe o caminho de criao de recursos conforme o que o contexto oferece
+    glDevice.init(forceLegacy);
+
     // Definindo as dimenses da viewport com as mesmas dimenses da janela da aplicao
-    int width, height;
-    glfwGetFramebufferSize(window, &width, &height);
-    glViewport(0, 0, width, height);
+    // (sem janela, as do framebuffer que faz o papel da tela)
+    int width = WIDTH, height = HEIGHT;
+    OffscreenTarget offscreen;
+    if (headless)
+    {
+        if (!offscreen.init(width, height))
+            return -1;
+        glState.setScreenFramebuffer(offscreen.target());
+        glState.bindFramebuffer(GL_FRAMEBUFFER, offscreen.target());
+    }
+    else
+        glfwGetFramebufferSize(window, &width, &height);
+    glState.viewport(0, 0, width, height);
+
+    // Variantes do uber-shader, compiladas sob demanda conforme os materiais.
+    // As fontes passam pelo pr-processador (#include) e so recarregadas ao salvar.
+    ShaderPreprocessor shaderPreprocessor;
+    ShaderVariantCache shaderCache(shaderPreprocessor, "../shaders/uber.vs", "../shaders/uber.fs");
+    ShaderHotReload shaderReload(shaderPreprocessor);
+    shaderReload.add(&shaderCache);
+    // Passo de luz do deferred (tringulo de tela cheia lendo o G-buffer)
+    ShaderVariantCache lightingCache(shaderPreprocessor, "../shaders/deferred.vs", "../shaders/deferred.fs");
+    shaderReload.add(&lightingCache);
+    // Profundidade vista da luz, para os mapas de sombra
+    ShaderVariantCache shadowCache(shaderPreprocessor, "../shaders/shadow.vs", "../shaders/shadow.fs");
+    shaderReload.add(&shadowCache);
+    // Pr-passo de profundidade (s a posio, sem cor)
+    ShaderVariantCache depthCache(shaderPreprocessor, "../shaders/depth.vs", "../shaders/depth.fs");
+    shaderReload.add(&depthCache);
+    shaderReload.start();
+
+    // Geometria indexada do cubo
+    Geometry cubeGeometry;
+    loadOBJ("cube.obj", cubeGeometry, glm::vec3(0.0, 1.0, 1.0));
+
+    Material cubeMaterial;
+    cubeMaterial.texID = carregarTextura("Cube.png");
+    cubeMaterial.shininess = 32.0f;
+
+    if ((benchmarkCubes > 0 || benchmarkCommands > 0) && !window)
+    {
+        std::cout << "--bench-instancing e --bench-commands precisam de janela (ou do backend OSMesa)" << std::endl;
+        benchmarkCubes = benchmarkCommands = 0;
+    }
+    if (benchmarkCubes > 0 || benchmarkCommands > 0)
+    {
+        if (benchmarkCubes > 0)
+            runInstancingBenchmark(window, shaderCache, cubeGeometry, cubeMaterial, benchmarkCubes);
+        if (benchmarkCommands > 0)
+            runCommandListBenchmark(window, shaderCache, cubeGeometry, cubeMaterial, benchmarkCommands);
+        shaderReload.stop();
+        shaderCache.clear();
+        glfwTerminate();
+        return 0;
+    }
 
-    // Compilando e buildando o programa de shader
-    GLuint shaderID = setupShader();
+    // A cena  um registro de entidades: cada cubo (Transform + MeshRef + MaterialRef
+    // + Bounds)  filho de um piv que gira com Velocity. Os cubos compartilham o VAO
+    // e entram na fila de desenho, que ordena por variante, textura e VAO.
+    GeometryBuffers cubeBuffers = uploadGeometry(cubeGeometry);
+    Registry registry;
+    TransformHierarchy transforms;
+    // ndice espacial da cena: s entram na fila os objetos que a rvore acha no frustum da
+    // cmera, e a sombra e o picking (tecla espao, pelo centro da tela) tambm passam por ela
+    SceneTree sceneTree;
+    std::vector<Entity> visibleEntities;
+    // Com --occlusion os cubos (marcados com Occluder) so rasterizados na CPU e um pode esconder o outro
+    OcclusionCuller occlusion;
+    long long occlusionTested = 0, occlusionHidden = 0, occlusionOccluders = 0;
+    RenderQueue renderQueue;
+    renderQueue.setStatsEnabled(queueStats);
+    // Dados que mudam todo quadro (as matrizes dos objetos) saem de um buffer circular de 3 quadros
+    StreamBuffer streamBuffer;
+    streamBuffer.init(1 << 20);
+    renderQueue.setStreamBuffer(&streamBuffer);
+    renderQueue.setDepthPrepass(&depthCache, prepassMode);
 
-    // Gerando um buffer simples, com a geometria de um tringulo
-    int nVerts;
-    GLuint VAO = loadSimpleOBJ("cube.obj", nVerts, glm::vec3(0.0, 1.0, 1.0));
+    glm::vec3 scale = glm::vec3(0.3f);
+    // Os pivs giram em sentidos opostos a 50 graus por segundo; o input mexe na posio deles e na escala dos cubos
+    Entity pivots[2];
+    pivots[0] = createTransformEntity(registry, transforms, ENTITY_NONE, glm::vec3(-0.75f, 0.0f, 0.0f));
+    pivots[1] = createTransformEntity(registry, transforms, ENTITY_NONE, glm::vec3(0.75f, 0.0f, 0.0f));
+    registry.add(pivots[0], Velocity()).angular = glm::vec3(0.0f, glm::radians(50.0f), 0.0f);
+    registry.add(pivots[1], Velocity()).angular = glm::vec3(0.0f, glm::radians(-50.0f), 0.0f);
+    Entity cubes[2];
+    cubes[0] = createMeshEntity(registry, transforms, sceneTree, pivots[0], cubeBuffers, cubeGeometry, &cubeMaterial,
+        glm::vec3(0.75f, 0.0f, 0.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), scale);
+    cubes[1] = createMeshEntity(registry, transforms, sceneTree, pivots[1], cubeBuffers, cubeGeometry, &cubeMaterial,
+        glm::vec3(-0.75f, 0.0f, 0.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), scale);
+    // Pivs e cubos so movidos pela simulao, em passos fixos
+    for (Entity pivot : pivots)
+        addMotionState(registry, transforms, pivot);
+    for (Entity cube : cubes)
+    {
+        addMotionState(registry, transforms, cube);
+        registry.add(cube, Occluder()).geometry = &cubeGeometry;
+    }
 
-    GLuint texID = carregarTextura("Cube.png");
+    // Com --lights as luzes pontuais so filhas dos pivs e giram com os cubos. Os
+    // programas iluminados ganham a variante CLUSTERED, que s percorre as luzes
+    // do cluster de cada fragmento.
+    // Features somadas aos programas iluminados (e ao passo de luz do deferred)
+    unsigned lightingFeatures = 0;
+    ClusteredLighting clusteredLighting;
+    if (pointLights > 0)
+    {
+        clusteredLighting.init();
+        clusteredLighting.setProjection(glm::radians(45.0f), (float)WIDTH / (float)HEIGHT, 0.1f, 100.0f, width, height);
+        lightingFeatures |= SHADER_CLUSTERED;
+        std::mt19937 random(42);
+        std::uniform_real_distribution<float> around(-1.5f, 1.5f), channel(0.0f, 1.0f), radius(0.3f, 0.6f);
+        for (int i = 0; i < pointLights; i++)
+        {
+            Entity light = createTransformEntity(registry, transforms, pivots[i % 2], glm::vec3(around(random), around(random) * 0.4f, around(random)));
+            PointLight& pointLight = registry.add(light, PointLight());
+            pointLight.color = glm::vec3(channel(random), channel(random), channel(random));
+            pointLight.intensity = 0.8f;
+            pointLight.radius = radius(random);
+        }
+    }
 
-    glm::vec3 position1 = glm::vec3(-0.75f, 0.0f, 0.0f);
-    glm::vec3 position2 = glm::vec3(0.75f, 0.0f, 0.0f);
-    glm::vec3 scale = glm::vec3(0.3f);
+    // Com --shadows a luz principal vira uma luz direcional, vinda de lightPos para a
+    // origem, com sombras em cascata at 20 unidades da cmera; o Phong da variante
+    // SHADOWS usa a mesma direo (CascadedShadows::apply). O cho  esttico: a sombra dele  desenhada
+    // uma vez nas pginas em cache, e s os cubos so redesenhados a cada quadro.
+    glm::vec3 lightPos = glm::vec3(0.0f, 5.0f, 0.0f);
+    CascadedShadows cascadedShadows;
+    Material groundMaterial;
+    groundMaterial.diffuseColor = glm::vec3(0.8f);
+    groundMaterial.shininess = 8.0f;
+    if (shadows && cascadedShadows.init(2048))
+    {
+        cascadedShadows.setLightDirection(-lightPos);
+        cascadedShadows.setProjection(glm::radians(45.0f), (float)WIDTH / (float)HEIGHT, 0.1f, 20.0f);
+        lightingFeatures |= SHADER_SHADOWS;
+        Entity ground = createMeshEntity(registry, transforms, sceneTree, ENTITY_NONE, cubeBuffers, cubeGeometry, &groundMaterial,
+            glm::vec3(0.0f, -0.5f, 0.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), glm::vec3(2.5f, 0.05f, 2.5f));
+        registry.add(ground, StaticMesh());
+    }
+    else
+        shadows = false;
+    renderQueue.setLightingFeatures(lightingFeatures);
+
+    // G-buffer do caminho deferred, criado mesmo comeando no forward para a troca pela tecla G ser imediata
+    DeferredRenderer deferredRenderer;
+    deferredRenderer.init(width, height);
+    bool lastDeferred = !deferredShading;
+    // Tempo de GPU da cena por caminho, medido tambm sem o profiler (a etiqueta  o caminho:
+    // 0 = forward, 1 = deferred). GL_TIMESTAMP para caber dentro da GL_TIME_ELAPSED do --benchmark
+    GpuQuery sceneTime(GL_TIMESTAMP);
+    double sceneGpuMs[2] = { 0.0, 0.0 }, sceneLastMs[2] = { -1.0, -1.0 };
+    int sceneGpuFrames[2] = { 0, 0 };
+    auto collectSceneTime = [&]() {
+        while (sceneTime.poll())
+        {
+            int path = (int)sceneTime.resultTag();
+            sceneLastMs[path] = sceneTime.milliseconds();
+            sceneGpuMs[path] += sceneLastMs[path];
+            sceneGpuFrames[path]++;
+        }
+    };
+    auto printSceneTime = [&](int path) {
+        std::cout << (path ? "deferred " : "forward ") << sceneGpuMs[path] / std::max(1, sceneGpuFrames[path]) << " ms em media ("
+            << sceneGpuFrames[path] << " quadros, ultimo " << sceneLastMs[path] << " ms)";
+    };
 
-    glUseProgram(shaderID);
-    glEnable(GL_DEPTH_TEST);
+    glState.enable(GL_DEPTH_TEST, true);
 
-    // Setando a matriz de projeo
+    // Matrizes de projeo e de visualizao
     glm::mat4 projection = glm::perspective(glm::radians(45.0f), (float)WIDTH / (float)HEIGHT, 0.1f, 100.0f);
-    GLint projectionLoc = glGetUniformLocation(shaderID, "projection");
-    glUniformMatrix4fv(projectionLoc, 1, GL_FALSE, glm::value_ptr(projection));
-
-    // Setando a matriz de visualizao
     glm::mat4 view = glm::lookAt(glm::vec3(1.5f, 1.5f, 1.5f), glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
-    GLint viewLoc = glGetUniformLocation(shaderID, "view");
-    glUniformMatrix4fv(viewLoc, 1, GL_FALSE, glm::value_ptr(view));
-
-    // Configuraes de iluminao
-    glUniform3f(glGetUniformLocation(shaderID, "lightPos"), 0.0f, 5.0f, 0.0f);
-    glUniform3f(glGetUniformLocation(shaderID, "viewPos"), 1.5f, 1.5f, 1.5f);
-    glUniform3f(glGetUniformLocation(shaderID, "lightColor"), 1.0f, 1.0f, 1.0f);
-    glUniform1f(glGetUniformLocation(shaderID, "shininess"), 32.0f);
+    glm::vec3 viewPos = glm::vec3(1.5f, 1.5f, 1.5f);
+    // No --benchmark a cmera segue o caminho gravado
+    Camera camera;
+    FrameBenchmark frameBenchmark;
+    std::vector<CameraPath::KeyEvent> keyEvents;
+    if (benchmark)
+        frameBenchmark.start(frameCount - FrameBenchmark::WARMUP_FRAMES);
+    // A cena vai para o alvo da resoluo dinmica e  ampliada para a tela no fim do quadro
+    DynamicResolution dynamicResolution;
+    if (dynamicResolutionMs > 0.0)
+        dynamicResolution.init(width, height, dynamicResolutionMs);
+    // Sem janela ningum est olhando a taxa de quadros, ento a captura espera em vez de descartar
+    FrameCapture frameCapture;
+    if (!capturePath.empty() && frameCapture.start(capturePath, width, height))
+        frameCapture.setBlocking(headless);
+
+    // A simulao (input e Velocity) anda em passos fixos de 1/simulationRate
+    // segundos, quantos couberem no tempo do quadro; o desenho mostra o ponto entre
+    // os dois ltimos passos em que o quadro caiu
+    FrameScheduler frameScheduler(1.0 / simulationRate);
+    frameScheduler.setFrameLimit(fpsLimit);
+    auto simulationStep = [&](float dt) {
+        saveMotionStates(registry);
+        glm::vec3 translation;
+        float scaleFactor;
+        processInput(dt, translation, scaleFactor);
+        scale *= scaleFactor;
+        for (Entity pivot : pivots)
+            registry.get<MotionState>(pivot)->position += translation;
+        for (Entity cube : cubes)
+            registry.get<MotionState>(cube)->scale = scale;
+        integrateVelocities(registry, dt);
+    };
+
+    // Sistemas do quadro, com o que cada um l e escreve; o escalonador roda em
+    // paralelo os que no conflitam e mantm a ordem dos demais
+    SystemScheduler scheduler;
+    scheduler.add("Interpolacao", componentMask<MotionState>(), componentMask<Transform>(), [&] {
+        interpolateMotion(registry, transforms, frameScheduler.alpha());
+    });
+    scheduler.add("Transformacoes", 0, componentMask<Transform>(), [&] {
+        transforms.update();
+    });
+    scheduler.add("Limites", componentMask<Transform>(), componentMask<Bounds>(), [&] {
+        updateWorldBounds(registry, transforms, sceneTree);
+    });
+    // Desenho (gravao da fila, ocluso) e Luzes (clusters) dividem o prprio trabalho no jobSystem
+    scheduler.add("Desenho", componentMask<Transform, MeshRef, MaterialRef, Bounds, Occluder>(), 0, [&] {
+        collectVisible(sceneTree, Frustum::fromMatrix(projection * view), visibleEntities);
+        submitVisible(registry, transforms, visibleEntities, occlusionCulling ? &occlusion : nullptr, projection * view, renderQueue);
+        if (occlusionCulling)
+        {
+            occlusionTested += occlusion.frameStats().tested;
+            occlusionHidden += occlusion.frameStats().occluded;
+            occlusionOccluders += occlusion.frameStats().occluders;
+        }
+    }, true);
+    if (pointLights > 0)
+    {
+        scheduler.add("Luzes", componentMask<Transform, PointLight>(), 0, [&] {
+            collectLights(registry, transforms, clusteredLighting);
+            clusteredLighting.assign(view);
+        }, true);
+    }
+    std::cout << "Sistemas: " << scheduler.describe() << std::endl;
 
     // Loop da aplicao - "game loop"
-    while (!glfwWindowShouldClose(window))
+    // Com --frames o loop para sozinho (sem janela  o nico jeito de parar)
+    int frame = 0;
+    bool quit = false;
+    double frameSeconds = 0.0;
+    while (!quit && (frameCount <= 0 || frame < frameCount) && !(window && glfwWindowShouldClose(window)))
     {
         // Checa se houveram eventos de input (key pressed, mouse moved etc.) e chama as funes de callback correspondentes
-        glfwPollEvents();
-        processInput(position1, scale);
-        processInput(position2, scale);
-
-        // Limpa o buffer de cor
-        glClearColor(1.0f, 1.0f, 1.0f, 1.0f); // cor de fundo
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-
-        float angle = (GLfloat)glfwGetTime() * 50.0f;
+        if (window)
+            glfwPollEvents();
+        glState.beginFrame();
+        frameBenchmark.beginFrame();
+        PROFILE_FRAME_BEGIN();
+        {
+            PROFILE_ZONE("Input");
+            // Troca os programas recompilados pelo hot reload antes de comear o quadro
+            shaderReload.update();
 
-        // Configuraes para o primeiro cubo
-        glm::mat4 model1 = glm::mat4(1.0f);
-        model1 = glm::translate(model1, position1);
-        model1 = glm::rotate(model1, glm::radians(angle), glm::vec3(0.0f, 1.0f, 0.0f));
-        model1 = glm::translate(model1, glm::vec3(0.75f, 0.0f, 0.0f));
-        model1 = glm::scale(model1, scale);
+            // --benchmark: teclas gravadas e cmera no tempo do caminho (parada no aquecimento)
+            if (benchmark)
+            {
+                float t = (float)std::max(0, frame - FrameBenchmark::WARMUP_FRAMES) / 60.0f;
+                if (frame >= FrameBenchmark::WARMUP_FRAMES)
+                {
+                    keyEvents.clear();
+                    cameraPath.eventsBetween(t, t + 1.0f / 60.0f, keyEvents);
+                    for (const CameraPath::KeyEvent& event : keyEvents)
+                        inputSystem.push(event.key, event.action);
+                }
+                cameraPath.sample(t, camera);
+                view = camera.GetViewMatrix();
+                viewPos = camera.Position;
+            }
 
-        GLint modelLoc = glGetUniformLocation(shaderID, "model");
-        glUniformMatrix4fv(modelLoc, 1, GL_FALSE, glm::value_ptr(model1));
+            // Sem janela (e no --benchmark) cada quadro vale 1/60 s de simulao, qualquer que seja a
+            // velocidade da mquina; reproduzindo uma sesso vale o tempo gravado
+            frameSeconds = inputSystem.update(headless || benchmark ? 1.0 / 60.0 : frameScheduler.measureFrame());
+            if (inputSystem.pressed(ACTION_QUIT) > 0)
+                quit = true;
+            if (inputSystem.pressed(ACTION_TOGGLE_DEFERRED) % 2 == 1)
+                deferredShading = !deferredShading;
+            if (inputSystem.pressed(ACTION_PICK) > 0)
+            {
+                // Raio de 100 unidades da cmera pelo centro da tela (as caixas so as do ltimo quadro)
+                SceneRay ray;
+                ray.origin = viewPos;
+                ray.direction = -100.0f * glm::vec3(glm::inverse(view)[2]);
+                float fraction;
+                Entity picked = pickEntity(registry, sceneTree, ray, fraction);
+                if (picked != ENTITY_NONE)
+                    std::cout << "Picking: entidade " << entityIndex(picked) << " a " << fraction * 100.0f << " unidades" << std::endl;
+                else
+                    std::cout << "Picking: nada no centro da tela" << std::endl;
+            }
+        }
+        {
+            PROFILE_ZONE("Simulacao");
+            int steps = frameScheduler.advance(frameSeconds);
+            for (int i = 0; i < steps; i++)
+                simulationStep((float)frameScheduler.step());
+        }
 
-        glActiveTexture(GL_TEXTURE0);
-        glBindTexture(GL_TEXTURE_2D, texID);
+        // Caminho do quadro (a tecla G troca; sem G-buffer fica no forward)
+        bool deferred = deferredShading && deferredRenderer.ready();
+        collectSceneTime();
+        if (deferred != lastDeferred)
+        {
+            std::cout << "Caminho: " << (deferred ? "deferred" : "forward");
+            // Na troca, o tempo de GPU que o caminho anterior teve at aqui
+            if (sceneGpuFrames[lastDeferred ? 1 : 0] > 0)
+            {
+                std::cout << " (tempo de GPU da cena no ";
+                printSceneTime(lastDeferred ? 1 : 0);
+                std::cout << ")";
+            }
+            std::cout << std::endl;
+            lastDeferred = deferred;
+        }
 
-        // Desenha o primeiro cubo
-        glBindVertexArray(VAO);
-        glDrawArrays(GL_TRIANGLES, 0, 36);
+        dynamicResolution.beginFrame();
+        // Os clusters so ladrilhos da tela em pixels, ento acompanham a escala
+        if (dynamicResolution.scaleChanged() && pointLights > 0)
+            clusteredLighting.setProjection(glm::radians(45.0f), (float)WIDTH / (float)HEIGHT, 0.1f, 100.0f,
+                dynamicResolution.renderWidth(), dynamicResolution.renderHeight());
+        {
+            // Cada caminho tem a sua zona no profiler (e o ttulo mostra o ltimo tempo de GPU dos dois)
+            PROFILE_GPU_ZONE(deferred ? "Cena (deferred)" : "Cena (forward)");
+            sceneTime.begin(deferred ? 1 : 0);
+            streamBuffer.beginFrame();
+
+            // Limpa o buffer de cor
+            glClearColor(1.0f, 1.0f, 1.0f, 1.0f); // cor de fundo
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+            renderQueue.begin(view, 100.0f);
+            scheduler.run();
+            if (pointLights > 0)
+                clusteredLighting.upload();
+            if (shadows)
+            {
+                cascadedShadows.update(view);
+                cascadedShadows.render(shadowCache.get(0), [&](Shader* shader, bool staticCasters, const glm::mat4& lightViewProjection) {
+                    drawShadowCasters(registry, transforms, sceneTree, shader, staticCasters, lightViewProjection);
+                });
+            }
 
-        // Configuraes para o segundo cubo
-        glm::mat4 model2 = glm::mat4(1.0f);
-        model2 = glm::translate(model2, position2);
-        model2 = glm::rotate(model2, glm::radians(-angle), glm::vec3(0.0f, 1.0f, 0.0f));
-        model2 = glm::translate(model2, glm::vec3(-0.75f, 0.0f, 0.0f));
-        model2 = glm::scale(model2, scale);
+            // Uniforms do quadro (reenviados todo quadro, j que um programa recarregado comea zerado)
+            auto setupFrame = [&](Shader* shader) {
+                shader->setMat4("projection", glm::value_ptr(projection));
+                shader->setMat4("view", glm::value_ptr(view));
+                shader->setVec3("lightPos", lightPos.x, lightPos.y, lightPos.z);
+                shader->setVec3("viewPos", viewPos.x, viewPos.y, viewPos.z);
+                shader->setVec3("lightColor", 1.0f, 1.0f, 1.0f);
+                if (pointLights > 0)
+                    clusteredLighting.apply(shader);
+                if (shadows)
+                    cascadedShadows.apply(shader);
+            };
+            if (deferred)
+            {
+                // Opacos no G-buffer, luz num passo de tela cheia, transparentes forward por cima
+                deferredRenderer.beginGeometry();
+                renderQueue.flush(shaderCache, setupFrame, [&] {
+                    deferredRenderer.resolve(lightingCache.get(lightingFeatures), projection * view, setupFrame);
+                });
+            }
+            else
+                renderQueue.flush(shaderCache, setupFrame);
+            streamBuffer.endFrame();
+            sceneTime.end();
+        }
+        dynamicResolution.endFrame();
 
-        glUniformMatrix4fv(modelLoc, 1, GL_FALSE, glm::value_ptr(model2));
+#if CG_PROFILING
+        // Mostra o resumo do profiler no ttulo da janela duas vezes por segundo
+        static double lastTitle = 0.0;
+        if (window && glfwGetTime() - lastTitle > 0.5)
+        {
+            glfwSetWindowTitle(window, Profiler::get().summary().c_str());
+            lastTitle = glfwGetTime();
+        }
+#endif
+        PROFILE_FRAME_END();
 
-        // Desenha o segundo cubo
-        glDrawArrays(GL_TRIANGLES, 0, 36);
+        frameCapture.capture(glState.screenFramebuffer());
+        frameBenchmark.submitted();
 
-        glBindVertexArray(0);
+        // Imagem do ltimo quadro, antes da troca (depois dela o back buffer fica indefinido)
+        frame++;
+        if (!outputPath.empty() && frame == frameCount && writeFramebufferPPM(outputPath, glState.screenFramebuffer(), width, height))
+            std::cout << "Quadro " << frame << " gravado em " << outputPath << std::endl;
 
         // Troca os buffers da tela
-        glfwSwapBuffers(window);
+        if (window)
+            glfwSwapBuffers(window);
+        frameScheduler.waitForNextFrame();
+        frameBenchmark.endFrame();
     }
 
-    // Pede pra OpenGL desalocar os buffers
-    glDeleteVertexArrays(1, &VAO);
-    glDeleteBuffers(1, &shaderID);
-    // Finaliza a execuo da GLFW, limpando os recursos alocados por ela
-    glfwTerminate();
-    return 0;
-}
-
-void key_callback(GLFWwindow* window, int key, int scancode, int action, int mode)
-{
-    if (key == GLFW_KEY_ESCAPE && action == GLFW_PRESS)
-        glfwSetWindowShouldClose(window, GL_TRUE);
-
-    if (key == GLFW_KEY_X && action == GLFW_PRESS)
+    if (benchmark)
     {
-        rotateX = true;
-        rotateY = false;
-        rotateZ = false;
+        frameBenchmark.finish();
+        std::string report = frameBenchmark.report(benchmarkScene, benchmarkPath);
+        std::cout << report;
+        std::ofstream json(benchmarkJson);
+        if (json)
+        {
+            json << report;
+            std::cout << "Benchmark gravado em " << benchmarkJson << std::endl;
+        }
+        else
+            std::cout << "Erro ao gravar " << benchmarkJson << std::endl;
     }
-
-    if (key == GLFW_KEY_Y && action == GLFW_PRESS)
+    frameBenchmark.release();
+    if (frameCapture.active())
     {
-        rotateX = false;
-        rotateY = true;
-        rotateZ = false;
+        frameCapture.stop();
+        const CaptureStats& captureStats = frameCapture.totalStats();
+        std::cout << "Captura: " << captureStats.written << " quadros gravados em " << capturePath << ", " << captureStats.dropped << " descartados, "
+            << captureStats.captureMs / std::max(1LL, captureStats.captured) << " ms por quadro na thread do GL, "
+            << captureStats.writeMs / std::max(1LL, captureStats.written) << " ms na gravacao";
+        if (captureStats.waits > 0)
+            std::cout << ", " << captureStats.waits << " esperas (" << captureStats.waitMs << " ms)";
+        std::cout << std::endl;
     }
 
-    if (key == GLFW_KEY_Z && action == GLFW_PRESS)
+    // Pede pra OpenGL desalocar os buffers
+    cubeBuffers.release();
+    streamBuffer.release();
+    clusteredLighting.release();
+    deferredRenderer.release();
+    cascadedShadows.release();
+    renderQueue.release();
+    if (dynamicResolution.ready())
     {
-        rotateX = false;
-        rotateY = false;
-        rotateZ = true;
+        const DynamicResolutionStats& resolutionStats = dynamicResolution.totalStats();
+        std::cout << "Resolucao dinamica: escala media " << resolutionStats.scaleSum / std::max(1, resolutionStats.frames) << ", minima "
+            << resolutionStats.minScale << ", " << resolutionStats.changes << " mudancas em " << resolutionStats.frames << " quadros, ultimo tempo de GPU "
+            << resolutionStats.gpuMs << " ms" << std::endl;
     }
-
-    if (key == GLFW_KEY_W && (action == GLFW_PRESS || action == GLFW_REPEAT))
-        moveYPos = true;
-    if (key == GLFW_KEY_W && action == GLFW_RELEASE)
-        moveYPos = false;
-
-    if (key == GLFW_KEY_S && (action == GLFW_PRESS || action == GLFW_REPEAT))
-        moveYNeg = true;
-    if (key == GLFW_KEY_S && action == GLFW_RELEASE)
-        moveYNeg = false;
-
-    if (key == GLFW_KEY_A && (action == GLFW_PRESS || action == GLFW_REPEAT))
-        moveXNeg = true;
-    if (key == GLFW_KEY_A && action == GLFW_RELEASE)
-        moveXNeg = false;
-
-    if (key == GLFW_KEY_D && (action == GLFW_PRESS || action == GLFW_REPEAT))
-        moveXPos = true;
-    if (key == GLFW_KEY_D && action == GLFW_RELEASE)
-        moveXPos = false;
-
-    if (key == GLFW_KEY_I && (action == GLFW_PRESS || action == GLFW_REPEAT))
-        moveZPos = true;
-    if (key == GLFW_KEY_I && action == GLFW_RELEASE)
-        moveZPos = false;
-
-    if (key == GLFW_KEY_J && (action == GLFW_PRESS || action == GLFW_REPEAT))
-        moveZNeg = true;
-    if (key == GLFW_KEY_J && action == GLFW_RELEASE)
-        moveZNeg = false;
-
-    if (key == GLFW_KEY_U && (action == GLFW_PRESS || action == GLFW_REPEAT))
-        scaleUp = true;
-    if (key == GLFW_KEY_U && action == GLFW_RELEASE)
-        scaleUp = false;
-
-    if (key == GLFW_KEY_P && (action == GLFW_PRESS || action == GLFW_REPEAT))
-        scaleDown = true;
-    if (key == GLFW_KEY_P && action == GLFW_RELEASE)
-        scaleDown = false;
-}
-
-void processInput(glm::vec3& position, glm::vec3& scale)
-{
-    if (moveXPos)
-        position.x += 0.01f;
-    if (moveXNeg)
-        position.x -= 0.01f;
-    if (moveYPos)
-        position.y += 0.01f;
-    if (moveYNeg)
-        position.y -= 0.01f;
-    if (moveZPos)
-        position.z += 0.01f;
-    if (moveZNeg)
-        position.z -= 0.01f;
-    if (scaleUp)
-        scale *= 1.01f;
-    if (scaleDown)
-        scale *= 0.99f;
-}
-
-int setupShader()
-{
-    // Vertex shader
-    GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
-    glCompileShader(vertexShader);
-    // Checando erros de compilao (exibio via log no terminal)
-    GLint success;
-    GLchar infoLog[512];
-    glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
-    if (!success)
+    dynamicResolution.release();
+    offscreen.release();
+    shaderReload.stop();
+    shaderCache.clear();
+    lightingCache.clear();
+    shadowCache.clear();
+    depthCache.clear();
+    jobSystem.stop();
+    // Espera a GPU para recolher as medies dos ltimos quadros
+    glFinish();
+    collectSceneTime();
+    sceneTime.release();
+    std::cout << "Tempo de GPU da cena: ";
+    printSceneTime(0);
+    std::cout << ", ";
+    printSceneTime(1);
+    std::cout << std::endl;
+    PROFILE_EXPORT("profile_trace.json");
+    PROFILE_RELEASE();
+
+    const GLStateStats& stateStats = glState.totalStats();
+    std::cout << "GLState: " << stateStats.requested << " trocas de estado pedidas, " << stateStats.issued << " enviadas, "
+        << stateStats.skipped() << " evitadas em " << glState.frameCount() << " quadros" << std::endl;
+    const FrameSchedulerStats& frameStats = frameScheduler.totalStats();
+    std::cout << "FrameScheduler: " << frameStats.steps << " passos de " << frameScheduler.step() * 1000.0 << " ms em " << frameStats.frames
+        << " quadros (max " << frameStats.maxStepsPerFrame << " por quadro), " << frameStats.droppedSeconds << " s descartados, "
+        << frameStats.waitSeconds << " s esperando o limite de quadros" << std::endl;
+    const StreamBufferStats& streamStats = streamBuffer.totalStats();
+    std::cout << "StreamBuffer: " << streamStats.bytes
+        << " bytes em " << streamStats.allocations << " alocacoes, " << streamStats.fenceWaits << " esperas de fence (" << streamStats.waitMs << " ms)";
+    if (streamStats.overflows > 0)
+        std::cout << ", " << streamStats.overflows << " alocacoes sem espaco";
+    std::cout << std::endl;
+    if (occlusionCulling)
+        std::cout << "OcclusionCuller: " << occlusionOccluders << " oclusores rasterizados, " << occlusionTested << " objetos testados, "
+            << occlusionHidden << " escondidos" << std::endl;
+    if (shadows)
     {
-        glGetShaderInfoLog(vertexShader, 512, NULL, infoLog);
-        std::cout << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n" << infoLog << std::endl;
+        const ShadowStats& shadowStats = cascadedShadows.totalStats();
+        std::cout << "CascadedShadows: " << shadowStats.frames << " quadros, paginas estaticas redesenhadas " << shadowStats.staticRedraws
+            << " vezes e reaproveitadas " << shadowStats.staticReuses << " vezes" << std::endl;
     }
-    // Fragment shader
-    GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(fragmentShader, 1, &fragmentShaderSource, NULL);
-    glCompileShader(fragmentShader);
-    // Checando erros de compilao (exibio via log no terminal)
-    glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success);
-    if (!success)
+    inputSystem.stop();
+    const InputStats& inputStats = inputSystem.totalStats();
+    std::cout << "Input: " << inputStats.events << " eventos, " << inputStats.dropped << " perdidos com a fila cheia";
+    if (!recordInput.empty() && replayInput.empty())
+        std::cout << ", " << inputStats.recordedFrames << " quadros gravados em " << recordInput;
+    if (!replayInput.empty())
+        std::cout << ", " << inputStats.replayedFrames << " quadros reproduzidos de " << replayInput;
+    std::cout << std::endl;
+    if (prepassMode != PREPASS_OFF)
     {
-        glGetShaderInfoLog(fragmentShader, 512, NULL, infoLog);
-        std::cout << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n" << infoLog << std::endl;
+        const OverdrawStats& overdraw = renderQueue.overdrawStats();
+        std::cout << "Pre-passo de profundidade: " << overdraw.prepassFrames << " de " << overdraw.frames << " quadros, overdraw dos opacos "
+            << overdraw.overdraw << " (" << overdraw.shaded << " fragmentos para " << overdraw.visible << " pixels visiveis)";
+        if (prepassMode == PREPASS_AUTO)
+            std::cout << ", " << overdraw.toggles << " trocas do modo automatico";
+        std::cout << std::endl;
     }
-    // Linkando os shaders e criando o identificador do programa de shader
-    GLuint shaderProgram = glCreateProgram();
-    glAttachShader(shaderProgram, vertexShader);
-    glAttachShader(shaderProgram, fragmentShader);
-    glLinkProgram(shaderProgram);
-    // Checando por erros de linkagem
-    glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
-    if (!success) {
-        glGetProgramInfoLog(shaderProgram, 512, NULL, infoLog);
-        std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n" << infoLog << std::endl;
-    }
-    glDeleteShader(vertexShader);
-    glDeleteShader(fragmentShader);
-
-    return shaderProgram;
-}
-
-int loadSimpleOBJ(string filepath, int& nVerts, glm::vec3 color)
-{
-    vector <glm::vec3> vertices;
-    vector <GLuint> indices;
-    vector <glm::vec2> texCoords;
-    vector <glm::vec3> normals;
-    vector <GLfloat> vbuffer;
-
-    ifstream inputFile;
-    inputFile.open(filepath.c_str());
-    if (inputFile.is_open())
+    if (pointLights > 0)
     {
-        char line[100];
-        string sline;
-
-        while (!inputFile.eof())
-        {
-            inputFile.getline(line, 100);
-            sline = line;
-
-            string word;
-            istringstream ssline(line);
-            ssline >> word;
-
-            if (word == "v")
-            {
-                glm::vec3 v;
-                ssline >> v.x >> v.y >> v.z;
-                vertices.push_back(v);
-            }
-            if (word == "vt")
-            {
-                glm::vec2 vt;
-                ssline >> vt.s >> vt.t;
-                texCoords.push_back(vt);
-            }
-            if (word == "vn")
-            {
-                glm::vec3 vn;
-                ssline >> vn.x >> vn.y >> vn.z;
-                normals.push_back(vn);
-            }
-            if (word == "f")
-            {
-                string tokens[3];
-                ssline >> tokens[0] >> tokens[1] >> tokens[2];
-
-                for (int i = 0; i < 3; i++)
-                {
-                    // Recuperando os ndices de v
-                    int pos = tokens[i].find("/");
-                    string token = tokens[i].substr(0, pos);
-                    int index = atoi(token.c_str()) - 1;
-                    indices.push_back(index);
-
-                    vbuffer.push_back(vertices[index].x);
-                    vbuffer.push_back(vertices[index].y);
-                    vbuffer.push_back(vertices[index].z);
-                    vbuffer.push_back(color.r);
-                    vbuffer.push_back(color.g);
-                    vbuffer.push_back(color.b);
-
-                    // Recuperando os ndices de vts
-                    tokens[i] = tokens[i].substr(pos + 1);
-                    pos = tokens[i].find("/");
-                    token = tokens[i].substr(0, pos);
-                    index = atoi(token.c_str()) - 1;
-                    vbuffer.push_back(texCoords[index].s);
-                    vbuffer.push_back(texCoords[index].t);
-
-                    // Recuperando os ndices de vns
-                    tokens[i] = tokens[i].substr(pos + 1);
-                    index = atoi(tokens[i].c_str()) - 1;
-                    vbuffer.push_back(normals[index].x);
-                    vbuffer.push_back(normals[index].y);
-                    vbuffer.push_back(normals[index].z);
-                }
-            }
-        }
+        const ClusterStats& lightStats = clusteredLighting.frameStats();
+        std::cout << "ClusteredLighting: " << lightStats.visibleLights << " de " << lightStats.lights << " luzes visiveis, " << lightStats.references
+            << " pares cluster-luz (max " << lightStats.maxPerCluster << " por cluster), " << lightStats.assignMs << " ms no ultimo quadro" << std::endl;
     }
-    else
+    if (queueStats)
     {
-        cout << "Problema ao encontrar o arquivo " << filepath << endl;
+        const RenderQueueStats& queueTotal = renderQueue.totalStats();
+        std::cout << "RenderQueue: " << queueTotal.items << " itens, trocas de programa/textura/VAO " << queueTotal.programChanges << "/"
+            << queueTotal.textureChanges << "/" << queueTotal.vaoChanges << " (na ordem de submisso seriam " << queueTotal.unsortedProgramChanges << "/"
+            << queueTotal.unsortedTextureChanges << "/" << queueTotal.unsortedVaoChanges << "), " << queueTotal.avoided() << " evitadas" << std::endl;
     }
-    inputFile.close();
-
-    GLuint VBO, VAO;
-
-    nVerts = vbuffer.size() / 11; // Provisrio
-
-    // Gerao do identificador do VBO
-    glGenBuffers(1, &VBO);
-
-    // Faz a conexo (vincula) do buffer como um buffer de array
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-
-    // Envia os dados do array de floats para o buffer da OpenGL
-    glBufferData(GL_ARRAY_BUFFER, vbuffer.size() * sizeof(GLfloat), vbuffer.data(), GL_STATIC_DRAW);
-
-    // Gerao do identificador do VAO (Vertex Array Object)
-    glGenVertexArrays(1, &VAO);
-
-    // Vincula (bind) o VAO primeiro, e em seguida conecta e seta o(s) buffer(s) de vrtices e os ponteiros para os atributos 
-    glBindVertexArray(VAO);
-
-    // Atributo posio (x, y, z)
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 11 * sizeof(GLfloat), (GLvoid*)0);
-    glEnableVertexAttribArray(0);
-
-    // Atributo cor (r, g, b)
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 11 * sizeof(GLfloat), (GLvoid*)(3 * sizeof(GLfloat)));
-    glEnableVertexAttribArray(1);
-
-    // Atributo coordenada de textura (s, t)
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 11 * sizeof(GLfloat), (GLvoid*)(6 * sizeof(GLfloat)));
-    glEnableVertexAttribArray(2);
-
-    // Atributo normal do vrtice (x, y, z)
-    glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, 11 * sizeof(GLfloat), (GLvoid*)(8 * sizeof(GLfloat)));
-    glEnableVertexAttribArray(3);
-
-    // Observe que isso  permitido, a chamada para glVertexAttribPointer registrou o VBO como o objeto de buffer de vrtice 
-    // atualmente vinculado - para que depois possamos desvincular com segurana
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    // Finaliza a execuo da GLFW, limpando os recursos alocados por ela
+    headlessContext.destroy();
+    glfwTerminate();
+    return 0;
+}
 
-    // Desvincula o VAO ( uma boa prtica desvincular qualquer buffer ou array para evitar bugs medonhos)
-    glBindVertexArray(0);
+void key_callback(GLFWwindow* /*window*/, int key, int /*scancode*/, int action, int /*mode*/)
+{
+    // O estado das aes s muda no inputSystem.update(), uma vez por quadro
+    inputSystem.push(key, action);
+}
 
-    return VAO;
+// Deslocamento dos pivs e fator de escala dos cubos pedidos pelas teclas em 'dt'
+// segundos de simulao. As velocidades so as do antigo 0.01 e 1.01 por quadro
+// a 60 quadros por segundo, agora independentes da taxa de quadros.
+void processInput(float dt, glm::vec3& translation, float& scaleFactor)
+{
+    const float speed = 0.6f; //Unidades por segundo
+    const float scaleRate = 0.6f; //Com a tecla segurada a escala  multiplicada por e^0.6 (~1.8) a cada segundo
+    translation = glm::vec3(0.0f);
+    if (inputSystem.active(ACTION_MOVE_RIGHT))
+        translation.x += speed * dt;
+    if (inputSystem.active(ACTION_MOVE_LEFT))
+        translation.x -= speed * dt;
+    if (inputSystem.active(ACTION_MOVE_UP))
+        translation.y += speed * dt;
+    if (inputSystem.active(ACTION_MOVE_DOWN))
+        translation.y -= speed * dt;
+    if (inputSystem.active(ACTION_MOVE_FORWARD))
+        translation.z += speed * dt;
+    if (inputSystem.active(ACTION_MOVE_BACK))
+        translation.z -= speed * dt;
+    scaleFactor = 1.0f;
+    if (inputSystem.active(ACTION_SCALE_UP))
+        scaleFactor *= expf(scaleRate * dt);
+    if (inputSystem.active(ACTION_SCALE_DOWN))
+        scaleFactor *= expf(-scaleRate * dt);
 }
 
 int carregarTextura(string caminho) {
-    GLuint texID;
-
-    // Gera o identificador da textura na memria 
-    glGenTextures(1, &texID);
-    glBindTexture(GL_TEXTURE_2D, texID);
-
-    // Ajusta os parmetros de wrapping e filtering
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    GLuint texID = 0;
 
     // Carregamento da imagem
     int width, height, nrChannels;
@@ -498,15 +879,18 @@ int carregarTextura(string caminho) {
 
     if (data)
     {
-        if (nrChannels == 3) // jpg, bmp
-        {
-            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, data);
-        }
-        else // png
-        {
-            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
-        }
-        glGenerateMipmap(GL_TEXTURE_2D);
+        // Textura de tamanho fixo com a cadeia de mipmaps inteira j alocada
+        bool rgb = (nrChannels == 3); // jpg, bmp
+        texID = glDevice.createTexture2D(rgb ? GL_RGB8 : GL_RGBA8, width, height);
+        glDevice.uploadTexture2D(texID, width, height, rgb ? GL_RGB : GL_RGBA, GL_UNSIGNED_BYTE, data);
+        glDevice.generateMipmap(texID);
+        PROFILE_UPLOAD((long long)width * height * nrChannels);
+
+        // Ajusta os parmetros de wrapping e filtering
+        glDevice.textureParameter(texID, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glDevice.textureParameter(texID, GL_TEXTURE_WRAP_T, GL_REPEAT);
+        glDevice.textureParameter(texID, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glDevice.textureParameter(texID, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
     }
     else
     {
@@ -514,7 +898,5 @@ int carregarTextura(string caminho) {
     }
     stbi_image_free(data);
 
-    glBindTexture(GL_TEXTURE_2D, 0);
-
     return texID;
 }
@@ -0,0 +1,201 @@
+#include "Profiler.h"
+
+#if CG_PROFILING
+
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <iostream>
+
+#include "GLState.h"
+
+// Pilha de zonas abertas da thread (cada thread mede as suas)
+struct OpenZone
+{
+	const char* name;
+	long long start;
+};
+static thread_local std::vector<OpenZone> openZones;
+
+Profiler& Profiler::get()
+{
+	static Profiler profiler;
+	return profiler;
+}
+
+Profiler::Profiler() : draws(0), triangles(0), uploaded(0)
+{
+	origin = std::chrono::steady_clock::now();
+	current.start = 0;
+	current.duration = 0;
+}
+
+long long Profiler::now() const
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - origin).count();
+}
+
+int Profiler::threadIndex()
+{
+	// Chamado com o mutex travado
+	auto it = threads.find(std::this_thread::get_id());
+	if (it != threads.end())
+		return it->second;
+	int index = (int)threads.size();
+	threads[std::this_thread::get_id()] = index;
+	return index;
+}
+
+void Profiler::beginFrame()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	current = Frame();
+	current.start = now();
+	draws = 0;
+	triangles = 0;
+	uploaded = 0;
+}
+
+void Profiler::endFrame()
+{
+	// Coleta todas as timer queries que j ficaram prontas (de quadros anteriores)
+	for (auto& zone : gpuZones)
+	{
+		while (zone.second.query.poll())
+		{
+			zone.second.lastMs = zone.second.query.milliseconds();
+			Zone gpu = { zone.first, -1, (long long)zone.second.query.resultTag(), (long long)(zone.second.query.result() / 1000) };
+			gpuHistory.push_back(gpu);
+		}
+	}
+
+	std::lock_guard<std::mutex> lock(mutex);
+	current.duration = now() - current.start;
+	current.counters.draws = draws;
+	current.counters.triangles = triangles;
+	current.counters.uploadedBytes = uploaded;
+	current.counters.stateChanges = glState.currentStats().issued;
+	last = current.counters;
+	lastFrameUs = current.duration;
+
+	history.push_back(current);
+	if ((int)history.size() > HISTORY)
+		history.pop_front();
+	// As zonas de GPU mais velhas que o histrico de quadros tambm saem
+	long long oldest = history.front().start;
+	size_t keep = 0;
+	while (keep < gpuHistory.size() && gpuHistory[keep].start < oldest)
+		keep++;
+	gpuHistory.erase(gpuHistory.begin(), gpuHistory.begin() + keep);
+}
+
+void Profiler::pushCpuZone(const char* name)
+{
+	OpenZone zone = { name, now() };
+	openZones.push_back(zone);
+}
+
+void Profiler::popCpuZone()
+{
+	if (openZones.empty())
+		return;
+	OpenZone zone = openZones.back();
+	openZones.pop_back();
+	long long end = now();
+
+	std::lock_guard<std::mutex> lock(mutex);
+	Zone closed = { zone.name, threadIndex(), zone.start, end - zone.start };
+	current.zones.push_back(closed);
+}
+
+void Profiler::beginGpuZone(const char* name)
+{
+	if (activeGpuZone)
+	{
+		std::cout << "Profiler: zona de GPU '" << name << "' aberta dentro de '" << activeGpuName << "' (uma zona de GPU por vez)" << std::endl;
+		return;
+	}
+	activeGpuName = name;
+	activeGpuZone = &gpuZones[activeGpuName];
+	activeGpuZone->query.begin((GLuint64)now());
+}
+
+void Profiler::endGpuZone()
+{
+	if (!activeGpuZone)
+		return;
+	activeGpuZone->query.end();
+	activeGpuZone = nullptr;
+}
+
+void Profiler::countDraw(long long triangles, long long instances)
+{
+	draws++;
+	this->triangles += triangles * instances;
+}
+
+void Profiler::countUpload(long long bytes)
+{
+	uploaded += bytes;
+}
+
+double Profiler::gpuZoneMs(const std::string& name) const
+{
+	auto it = gpuZones.find(name);
+	return it == gpuZones.end() ? -1.0 : it->second.lastMs;
+}
+
+std::string Profiler::summary() const
+{
+	std::ostringstream out;
+	out << std::fixed << std::setprecision(2) << lastFrameMs() << " ms CPU";
+	for (auto& zone : gpuZones)
+	{
+		if (zone.second.lastMs >= 0.0)
+			out << " | " << zone.first << " " << zone.second.lastMs << " ms GPU";
+	}
+	out << " | " << last.draws << " draws, " << last.triangles << " tri, " << last.stateChanges << " estados, " << last.uploadedBytes << " B";
+	return out.str();
+}
+
+bool Profiler::writeChromeTrace(const std::string& path)
+{
+	std::ofstream file(path.c_str());
+	if (!file.is_open())
+	{
+		std::cout << "Profiler: no foi possvel gravar " << path << std::endl;
+		return false;
+	}
+
+	std::lock_guard<std::mutex> lock(mutex);
+	file << "{\"traceEvents\":[\n";
+	file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1000,\"args\":{\"name\":\"GPU\"}}";
+	for (auto& thread : threads)
+		file << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << thread.second << ",\"args\":{\"name\":\"CPU " << thread.second << "\"}}";
+
+	for (const Frame& frame : history)
+	{
+		file << ",\n{\"name\":\"Frame\",\"ph\":\"X\",\"pid\":1,\"tid\":0,\"ts\":" << frame.start << ",\"dur\":" << frame.duration << "}";
+		for (const Zone& zone : frame.zones)
+			file << ",\n{\"name\":\"" << zone.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << zone.thread << ",\"ts\":" << zone.start << ",\"dur\":" << zone.duration << "}";
+		file << ",\n{\"name\":\"Contadores\",\"ph\":\"C\",\"pid\":1,\"ts\":" << frame.start << ",\"args\":{\"draws\":" << frame.counters.draws
+			<< ",\"triangulos\":" << frame.counters.triangles << ",\"estados\":" << frame.counters.stateChanges << ",\"bytes\":" << frame.counters.uploadedBytes << "}}";
+	}
+	// O tempo de GPU  desenhado a partir do instante em que o passo comeou na CPU
+	for (const Zone& zone : gpuHistory)
+		file << ",\n{\"name\":\"" << zone.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":1000,\"ts\":" << zone.start << ",\"dur\":" << zone.duration << "}";
+	file << "\n]}\n";
+
+	std::cout << "Profiler: trace gravado em " << path << std::endl;
+	return true;
+}
+
+void Profiler::release()
+{
+	for (auto& zone : gpuZones)
+		zone.second.query.release();
+	gpuZones.clear();
+	activeGpuZone = nullptr;
+}
+
+#endif
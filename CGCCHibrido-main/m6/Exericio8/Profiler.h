@@ -0,0 +1,154 @@
+#pragma once
+
+// Instrumentao de CPU e GPU: zonas nomeadas, timer queries por passo de
+// renderizao e contadores por quadro (draws, tringulos, trocas de estado
+// e bytes enviados), com exportao no formato de trace do Chrome
+// (chrome://tracing ou ui.perfetto.dev).
+//
+// S existe em builds de debug: com NDEBUG definido (Release) as macros
+// PROFILE_* viram nada e esse cdigo nem  compilado. Para forar num build
+// de release, defina CG_PROFILING=1.
+#ifndef CG_PROFILING
+#ifdef NDEBUG
+#define CG_PROFILING 0
+#else
+#define CG_PROFILING 1
+#endif
+#endif
+
+#if CG_PROFILING
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "GpuQuery.h"
+
+// Contadores de um quadro
+struct ProfileCounters
+{
+	long long draws = 0;
+	long long triangles = 0;
+	long long stateChanges = 0;
+	long long uploadedBytes = 0;
+};
+
+class Profiler
+{
+public:
+	// Quantos quadros ficam guardados para o trace
+	static const int HISTORY = 600;
+
+	static Profiler& get();
+
+	void beginFrame();
+	void endFrame();
+
+	void pushCpuZone(const char* name);
+	void popCpuZone();
+	// Zonas de GPU so pares de GL_TIMESTAMP (cabem dentro da GL_TIME_ELAPSED do
+	// --benchmark), mas s uma fica aberta por vez
+	void beginGpuZone(const char* name);
+	void endGpuZone();
+
+	void countDraw(long long triangles, long long instances = 1);
+	void countUpload(long long bytes);
+
+	const ProfileCounters& lastCounters() const { return last; }
+	double lastFrameMs() const { return lastFrameUs / 1000.0; }
+	// ltimo tempo de GPU medido para o passo (ms), ou -1 se ainda no h medida
+	double gpuZoneMs(const std::string& name) const;
+	// Resumo de uma linha (ex.: para o ttulo da janela)
+	std::string summary() const;
+
+	bool writeChromeTrace(const std::string& path);
+	// Libera as queries (chamar antes de destruir o contexto OpenGL)
+	void release();
+
+protected:
+	struct Zone
+	{
+		std::string name;
+		int thread;
+		long long start; //Microssegundos desde o incio do profiler
+		long long duration;
+	};
+
+	struct Frame
+	{
+		long long start;
+		long long duration;
+		ProfileCounters counters;
+		std::vector<Zone> zones;
+	};
+
+	struct GpuZone
+	{
+		GpuQuery query{ GL_TIMESTAMP };
+		double lastMs = -1.0;
+	};
+
+	Profiler();
+	long long now() const;
+	int threadIndex();
+
+	std::chrono::steady_clock::time_point origin;
+	std::mutex mutex;
+	std::map<std::string, GpuZone> gpuZones;
+	GpuZone* activeGpuZone = nullptr;
+	std::string activeGpuName;
+
+	Frame current;
+	std::deque<Frame> history;
+	std::vector<Zone> gpuHistory;
+	ProfileCounters last;
+	long long lastFrameUs = 0;
+	std::atomic<long long> draws, triangles, uploaded;
+	std::map<std::thread::id, int> threads;
+};
+
+// Zona de CPU com escopo (fecha sozinha no fim do bloco)
+struct ProfileCpuScope
+{
+	ProfileCpuScope(const char* name) { Profiler::get().pushCpuZone(name); }
+	~ProfileCpuScope() { Profiler::get().popCpuZone(); }
+};
+
+// Zona de GPU (e de CPU) com escopo
+struct ProfileGpuScope
+{
+	ProfileGpuScope(const char* name) { Profiler::get().pushCpuZone(name); Profiler::get().beginGpuZone(name); }
+	~ProfileGpuScope() { Profiler::get().endGpuZone(); Profiler::get().popCpuZone(); }
+};
+
+#define CG_PROFILE_CONCAT2(a, b) a##b
+#define CG_PROFILE_CONCAT(a, b) CG_PROFILE_CONCAT2(a, b)
+
+#define PROFILE_FRAME_BEGIN() Profiler::get().beginFrame()
+#define PROFILE_FRAME_END() Profiler::get().endFrame()
+#define PROFILE_ZONE(name) ProfileCpuScope CG_PROFILE_CONCAT(profileZone, __LINE__)(name)
+#define PROFILE_GPU_ZONE(name) ProfileGpuScope CG_PROFILE_CONCAT(profileGpuZone, __LINE__)(name)
+#define PROFILE_DRAW(triangles) Profiler::get().countDraw(triangles)
+#define PROFILE_DRAW_INSTANCED(triangles, instances) Profiler::get().countDraw(triangles, instances)
+#define PROFILE_UPLOAD(bytes) Profiler::get().countUpload(bytes)
+#define PROFILE_EXPORT(path) Profiler::get().writeChromeTrace(path)
+#define PROFILE_RELEASE() Profiler::get().release()
+
+#else
+
+#define PROFILE_FRAME_BEGIN() ((void)0)
+#define PROFILE_FRAME_END() ((void)0)
+#define PROFILE_ZONE(name) ((void)0)
+#define PROFILE_GPU_ZONE(name) ((void)0)
+#define PROFILE_DRAW(triangles) ((void)0)
+#define PROFILE_DRAW_INSTANCED(triangles, instances) ((void)0)
+#define PROFILE_UPLOAD(bytes) ((void)0)
+#define PROFILE_EXPORT(path) ((void)0)
+#define PROFILE_RELEASE() ((void)0)
+
+#endif
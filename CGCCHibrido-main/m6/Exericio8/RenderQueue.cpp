@@ -0,0 +1,492 @@
+#include "RenderQueue.h"
+
+#include <algorithm>
+#include <cstring>
+
+//GLM
+#include <glm/gtc/type_ptr.hpp>
+
+#include "GLState.h"
+#include "JobSystem.h"
+#include "Profiler.h"
+
+static const uint64_t DEPTH_MAX = (1u << 24) - 1;
+// Histerese do pr-passo automtico (fragmentos sombreados por pixel visvel)
+static const double PREPASS_ENABLE_OVERDRAW = 1.5;
+static const double PREPASS_DISABLE_OVERDRAW = 1.2;
+// Com o pr-passo desligado, a cada quantos quadros um deles o faz para medir os pixels visveis
+static const int PREPASS_PROBE_INTERVAL = 60;
+
+void RenderQueueStats::add(const RenderQueueStats& other)
+{
+	items += other.items;
+	programChanges += other.programChanges;
+	textureChanges += other.textureChanges;
+	vaoChanges += other.vaoChanges;
+	unsortedProgramChanges += other.unsortedProgramChanges;
+	unsortedTextureChanges += other.unsortedTextureChanges;
+	unsortedVaoChanges += other.unsortedVaoChanges;
+}
+
+CommandList::CommandList() : view(1.0f), farPlane(100.0f), objects(nullptr), objectOffset(0), objectStride(0), capacity(0)
+{
+}
+
+void CommandList::reset(const glm::mat4& view, float farPlane, char* objects, GLintptr objectOffset, GLsizeiptr objectStride, int capacity)
+{
+	this->view = view;
+	this->farPlane = farPlane;
+	this->objects = objects;
+	this->objectOffset = objectOffset;
+	this->objectStride = objectStride;
+	this->capacity = capacity;
+	items.clear();
+	entries.clear();
+}
+
+void CommandList::submit(RenderPass pass, GLuint vao, GLsizei indexCount, const Material& material, const glm::mat4& model, GLuint depthVao)
+{
+	// Distncia da origem do objeto at a cmera, ao longo da direo de viso
+	float depth = -(view * model[3]).z / farPlane;
+
+	SortEntry entry;
+	entry.key = RenderQueue::makeKey(pass, material.features(), material.texID, vao, depth);
+	entry.item = (uint32_t)items.size();
+	entries.push_back(entry);
+
+	RenderItem item;
+	item.vao = vao;
+	item.depthVao = depthVao != 0 ? depthVao : vao;
+	item.indexCount = indexCount;
+	item.material = &material;
+	// Com lugar reservado no StreamBuffer a matriz vai direto para l
+	if (objects && (int)items.size() < capacity)
+	{
+		memcpy(objects + items.size() * objectStride, glm::value_ptr(model), sizeof(glm::mat4));
+		item.object = objectOffset + items.size() * objectStride;
+	}
+	else
+	{
+		item.object = -1;
+		item.model = model;
+	}
+	items.push_back(item);
+}
+
+void CommandList::sort()
+{
+	if (entries.size() < 2)
+		return;
+	scratch.resize(entries.size());
+	for (int shift = 0; shift < 64; shift += 8)
+	{
+		size_t count[256] = {};
+		for (const SortEntry& entry : entries)
+			count[(entry.key >> shift) & 0xFF]++;
+		// Byte igual em todas as chaves: esse passo no mudaria a ordem
+		if (count[(entries[0].key >> shift) & 0xFF] == entries.size())
+			continue;
+
+		size_t offset = 0;
+		for (int digit = 0; digit < 256; digit++)
+		{
+			size_t n = count[digit];
+			count[digit] = offset;
+			offset += n;
+		}
+		for (const SortEntry& entry : entries)
+			scratch[count[(entry.key >> shift) & 0xFF]++] = entry;
+		entries.swap(scratch);
+	}
+}
+
+RenderQueue::RenderQueue() : view(1.0f), farPlane(100.0f), activeLists(0), statsOn(false), lightingFeatures(0), stream(nullptr),
+	depthShaders(nullptr), prepassMode(PREPASS_OFF), prepassActive(false), autoPrepass(false),
+	prepassSamples(GL_SAMPLES_PASSED), opaqueSamples(GL_SAMPLES_PASSED), visibleSamples(GL_SAMPLES_PASSED)
+{
+}
+
+void RenderQueue::setDepthPrepass(ShaderVariantCache* depthShaders, DepthPrepassMode mode)
+{
+	this->depthShaders = depthShaders;
+	prepassMode = depthShaders ? mode : PREPASS_OFF;
+	autoPrepass = false;
+}
+
+void RenderQueue::release()
+{
+	prepassSamples.release();
+	opaqueSamples.release();
+	visibleSamples.release();
+}
+
+uint64_t RenderQueue::makeKey(RenderPass pass, unsigned features, GLuint texture, GLuint vao, float depth)
+{
+	uint64_t quantized = (uint64_t)(std::min(std::max(depth, 0.0f), 1.0f) * DEPTH_MAX);
+	uint64_t state = ((uint64_t)(features & 0xFF) << 30) | ((uint64_t)(texture & 0x3FFF) << 16) | (vao & 0xFFFF);
+	uint64_t key = (uint64_t)pass << 62;
+	if (pass == PASS_TRANSPARENT)
+		return key | ((DEPTH_MAX - quantized) << 38) | state;
+	return key | (state << 24) | quantized;
+}
+
+void RenderQueue::begin(const glm::mat4& view, float farPlane)
+{
+	this->view = view;
+	this->farPlane = farPlane;
+	main.reset(view, farPlane, nullptr, 0, 0, 0);
+	activeLists = 0;
+	commands.clear();
+}
+
+void RenderQueue::submit(RenderPass pass, GLuint vao, GLsizei indexCount, const Material& material, const glm::mat4& model, GLuint depthVao)
+{
+	main.submit(pass, vao, indexCount, material, model, depthVao);
+}
+
+void RenderQueue::record(int count, int grain, const RecordJob& job)
+{
+	PROFILE_ZONE("RenderQueue::record");
+	if (count <= 0)
+		return;
+	grain = std::max(1, grain);
+	int chunks = (count + grain - 1) / grain;
+	int firstList = activeLists;
+	activeLists += chunks;
+	if ((int)lists.size() < activeLists)
+		lists.resize(activeLists);
+
+	// Um pedao do StreamBuffer com lugar para uma matriz por ndice; o bloco
+	// que comea em 'begin' escreve a partir da matriz 'begin'
+	StreamAllocation objects;
+	GLsizeiptr objectStride = 0;
+	if (stream)
+	{
+		GLsizeiptr alignment = stream->uniformOffsetAlignment();
+		objectStride = (sizeof(glm::mat4) + alignment - 1) / alignment * alignment;
+		objects = stream->allocateUniform(objectStride * count);
+	}
+
+	jobSystem.parallelFor(chunks, 1, [&](int chunkBegin, int chunkEnd) {
+		for (int chunk = chunkBegin; chunk < chunkEnd; chunk++)
+		{
+			int begin = chunk * grain, end = std::min(count, begin + grain);
+			CommandList& list = lists[firstList + chunk];
+			if (objects.data)
+				list.reset(view, farPlane, (char*)objects.data + begin * objectStride, objects.offset + begin * objectStride, objectStride, end - begin);
+			else
+				list.reset(view, farPlane, nullptr, 0, 0, 0);
+			job(list, begin, end);
+			list.sort();
+		}
+	});
+}
+
+int RenderQueue::size() const
+{
+	int count = main.size();
+	for (int i = 0; i < activeLists; i++)
+		count += lists[i].size();
+	return count;
+}
+
+void RenderQueue::merge()
+{
+	// Listas com itens; a do submit() primeiro, para desempatar na ordem de submisso
+	std::vector<const CommandList*> sources;
+	if (main.size() > 0)
+		sources.push_back(&main);
+	for (int i = 0; i < activeLists; i++)
+		if (lists[i].size() > 0)
+			sources.push_back(&lists[i]);
+
+	commands.clear();
+	commands.reserve(size());
+	if (sources.size() == 1)
+	{
+		const CommandList& list = *sources[0];
+		for (const CommandList::SortEntry& entry : list.entries)
+			commands.push_back({ entry.key, &list.items[entry.item] });
+		return;
+	}
+
+	// Heap com a prxima chave de cada lista (menor chave no topo; empate vai para a lista anterior)
+	struct Head
+	{
+		uint64_t key;
+		int source;
+		int position;
+	};
+	auto later = [](const Head& a, const Head& b) { return a.key != b.key ? a.key > b.key : a.source > b.source; };
+	std::vector<Head> heads;
+	for (int i = 0; i < (int)sources.size(); i++)
+		heads.push_back({ sources[i]->entries[0].key, i, 0 });
+	std::make_heap(heads.begin(), heads.end(), later);
+	while (!heads.empty())
+	{
+		std::pop_heap(heads.begin(), heads.end(), later);
+		Head& head = heads.back();
+		const CommandList& list = *sources[head.source];
+		commands.push_back({ head.key, &list.items[list.entries[head.position].item] });
+		if (++head.position < (int)list.entries.size())
+		{
+			head.key = list.entries[head.position].key;
+			std::push_heap(heads.begin(), heads.end(), later);
+		}
+		else
+			heads.pop_back();
+	}
+}
+
+bool RenderQueue::updateDepthPrepass()
+{
+	if (prepassMode == PREPASS_OFF)
+		return false;
+
+	// A medio de cada quadro chega alguns quadros depois; cada contagem tem a sua query
+	while (prepassSamples.poll())
+		overdraw.shaded = prepassSamples.result();
+	while (opaqueSamples.poll())
+		overdraw.shaded = opaqueSamples.result();
+	while (visibleSamples.poll())
+		overdraw.visible = visibleSamples.result();
+	if (overdraw.visible > 0)
+		overdraw.overdraw = (double)overdraw.shaded / overdraw.visible;
+
+	bool prepass = true;
+	if (prepassMode == PREPASS_AUTO)
+	{
+		// Histerese para no alternar a cada quadro perto do limite
+		bool enable = autoPrepass ? overdraw.overdraw >= PREPASS_DISABLE_OVERDRAW : overdraw.overdraw > PREPASS_ENABLE_OVERDRAW;
+		if (enable != autoPrepass)
+		{
+			autoPrepass = enable;
+			overdraw.toggles++;
+		}
+		// Desligado, os pixels visveis no so mais medidos; de vez em quando um quadro faz o pr-passo para renov-los
+		prepass = autoPrepass || overdraw.frames % PREPASS_PROBE_INTERVAL == 0;
+	}
+	overdraw.frames++;
+	if (prepass)
+		overdraw.prepassFrames++;
+	return prepass;
+}
+
+void RenderQueue::drawDepthPrepass(const std::function<void(Shader*)>& setupShader)
+{
+	PROFILE_ZONE("RenderQueue::depthPrepass");
+	glState.enable(GL_BLEND, false);
+	glState.colorMask(false);
+	glState.depthMask(true);
+	glState.depthFunc(GL_LESS);
+	prepassSamples.begin();
+
+	Shader* shader = nullptr;
+	unsigned features = ~0u;
+	GLuint vao = ~0u;
+	for (const DrawCommand& command : commands)
+	{
+		// Os opacos vm antes dos transparentes na ordem das chaves
+		if ((int)(command.key >> 62) != PASS_OPAQUE)
+			break;
+		const RenderItem& item = *command.item;
+
+		unsigned itemFeatures = item.object >= 0 ? SHADER_OBJECT_BUFFER : 0;
+		if (itemFeatures != features)
+		{
+			features = itemFeatures;
+			shader = depthShaders->get(features);
+			if (shader)
+			{
+				shader->Use();
+				setupShader(shader);
+			}
+		}
+		// Variante que no compilou: o item fica fora do pr-passo
+		if (!shader)
+			continue;
+		if (item.depthVao != vao)
+		{
+			vao = item.depthVao;
+			glState.bindVertexArray(vao);
+		}
+
+		if (item.object >= 0)
+			glState.bindBufferRange(GL_UNIFORM_BUFFER, UNIFORM_BINDING_OBJECT, stream->buffer(), item.object, sizeof(glm::mat4));
+		else
+			shader->setMat4("model", glm::value_ptr(item.model));
+		glDrawElements(GL_TRIANGLES, item.indexCount, GL_UNSIGNED_INT, 0);
+		PROFILE_DRAW(item.indexCount / 3);
+	}
+
+	prepassSamples.end();
+	glState.colorMask(true);
+}
+
+void RenderQueue::countUnsortedChanges(RenderQueueStats& stats) const
+{
+	unsigned features = ~0u;
+	GLuint texture = ~0u, vao = ~0u;
+	auto count = [&](const CommandList& list) {
+		for (const RenderItem& item : list.items)
+		{
+			if (item.material->features() != features)
+			{
+				features = item.material->features();
+				stats.unsortedProgramChanges++;
+			}
+			if (item.material->texID != texture)
+			{
+				texture = item.material->texID;
+				stats.unsortedTextureChanges++;
+			}
+			if (item.vao != vao)
+			{
+				vao = item.vao;
+				stats.unsortedVaoChanges++;
+			}
+		}
+	};
+	count(main);
+	for (int i = 0; i < activeLists; i++)
+		count(lists[i]);
+}
+
+void RenderQueue::flush(ShaderVariantCache& shaders, const std::function<void(Shader*)>& setupShader, const std::function<void()>& resolveOpaque)
+{
+	PROFILE_ZONE("RenderQueue::flush");
+	RenderQueueStats stats;
+	stats.items = size();
+	if (statsOn)
+		countUnsortedChanges(stats);
+
+	// As matrizes do submit() vo para um pedao do StreamBuffer, cada uma
+	// alinhada para glBindBufferRange; se no couberem, ficam no uniform model.
+	// As do record() as threads j escreveram.
+	main.sort();
+	if (stream && main.size() > 0)
+	{
+		GLsizeiptr alignment = stream->uniformOffsetAlignment();
+		GLsizeiptr objectStride = (sizeof(glm::mat4) + alignment - 1) / alignment * alignment;
+		StreamAllocation objects = stream->allocateUniform(objectStride * main.size());
+		if (objects.data)
+		{
+			for (size_t i = 0; i < main.items.size(); i++)
+			{
+				memcpy((char*)objects.data + i * objectStride, glm::value_ptr(main.items[i].model), sizeof(glm::mat4));
+				main.items[i].object = objects.offset + i * objectStride;
+			}
+		}
+	}
+	if (stream)
+		stream->flush();
+	merge();
+
+	// O pr-passo escreve a profundidade dos opacos e a medio em volta do passo
+	// principal deles conta os pixels visveis (com o pr-passo) ou os sombreados (sem)
+	bool measure = prepassMode != PREPASS_OFF;
+	prepassActive = updateDepthPrepass();
+	if (prepassActive)
+		drawDepthPrepass(setupShader);
+	GpuQuery& opaqueQuery = prepassActive ? visibleSamples : opaqueSamples;
+	if (measure)
+		opaqueQuery.begin();
+
+	bool deferred = (bool)resolveOpaque;
+	bool opaque = true;
+	int pass = -1;
+	Shader* shader = nullptr;
+	unsigned features = ~0u;
+	const Material* material = nullptr;
+	GLuint texture = ~0u, vao = ~0u;
+	auto endOpaque = [&]() {
+		if (!opaque)
+			return;
+		opaque = false;
+		if (measure)
+			opaqueQuery.end();
+		if (deferred)
+		{
+			resolveOpaque();
+			deferred = false;
+			// O passo de luz trocou o programa e o VAO
+			features = ~0u;
+			vao = ~0u;
+		}
+	};
+	for (const DrawCommand& command : commands)
+	{
+		const RenderItem& item = *command.item;
+
+		int itemPass = (int)(command.key >> 62);
+		if (itemPass != pass)
+		{
+			if (itemPass == PASS_TRANSPARENT)
+				endOpaque();
+			// Transparentes: blend ligado e sem escrever profundidade, para no esconder os de trs
+			bool transparent = itemPass == PASS_TRANSPARENT;
+			glState.enable(GL_BLEND, transparent);
+			if (transparent)
+				glState.blendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+			// Depois do pr-passo a profundidade dos opacos j est pronta: s passa o fragmento da frente
+			glState.depthFunc(prepassActive && !transparent ? GL_EQUAL : GL_LESS);
+			glState.depthMask(!transparent && !prepassActive);
+			pass = itemPass;
+		}
+
+		unsigned itemFeatures = item.material->features() | (item.object >= 0 ? SHADER_OBJECT_BUFFER : 0);
+		if (deferred)
+			itemFeatures |= SHADER_GBUFFER;
+		else if (itemFeatures & SHADER_LIT)
+			itemFeatures |= lightingFeatures;
+		if (itemFeatures != features)
+		{
+			features = itemFeatures;
+			shader = shaders.get(features);
+			if (shader)
+			{
+				shader->Use();
+				setupShader(shader);
+				stats.programChanges++;
+			}
+			// Programa novo: os uniforms do material precisam ser reenviados
+			material = nullptr;
+		}
+		// Variante que no compilou: os itens dela no so desenhados at a fonte ser corrigida
+		if (!shader)
+			continue;
+		if (item.material != material)
+		{
+			material = item.material;
+			material->apply(shader);
+			if (material->texID != texture)
+			{
+				texture = material->texID;
+				stats.textureChanges++;
+			}
+		}
+		if (item.vao != vao)
+		{
+			vao = item.vao;
+			glState.bindVertexArray(vao);
+			stats.vaoChanges++;
+		}
+
+		if (item.object >= 0)
+			glState.bindBufferRange(GL_UNIFORM_BUFFER, UNIFORM_BINDING_OBJECT, stream->buffer(), item.object, sizeof(glm::mat4));
+		else
+			shader->setMat4("model", glm::value_ptr(item.model));
+		glDrawElements(GL_TRIANGLES, item.indexCount, GL_UNSIGNED_INT, 0);
+		PROFILE_DRAW(item.indexCount / 3);
+	}
+
+	// Sem transparentes o G-buffer  resolvido aqui
+	endOpaque();
+	if (pass == PASS_TRANSPARENT)
+		glState.enable(GL_BLEND, false);
+	glState.depthFunc(GL_LESS);
+	glState.depthMask(true);
+
+	lastFrame = stats;
+	total.add(stats);
+}
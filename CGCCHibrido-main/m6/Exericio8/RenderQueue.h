@@ -0,0 +1,203 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <functional>
+
+//GLM
+#include <glm/glm.hpp>
+
+#include "GpuQuery.h"
+#include "Material.h"
+#include "StreamBuffer.h"
+
+// Passadas, na ordem em que so desenhadas
+enum RenderPass
+{
+	PASS_OPAQUE = 0,
+	PASS_TRANSPARENT = 1
+};
+
+// O que  preciso para desenhar um item da fila
+struct RenderItem
+{
+	GLuint vao;
+	GLuint depthVao; //S posies, para o pr-passo de profundidade
+	GLsizei indexCount;
+	const Material* material;
+	GLintptr object; //Posio da matriz no StreamBuffer (-1 = uniform 'model')
+	glm::mat4 model; //S usada com object = -1
+};
+
+// Itens gravados por uma thread. As chaves so calculadas e ordenadas ali
+// mesmo, e com um StreamBuffer as matrizes j vo direto para o trecho dele
+// reservado para a lista, ento o flush() s junta listas j ordenadas.
+class CommandList
+{
+public:
+	CommandList();
+
+	// 'depthVao' (s posies)  usado no pr-passo de profundidade; 0 = o prprio 'vao'
+	void submit(RenderPass pass, GLuint vao, GLsizei indexCount, const Material& material, const glm::mat4& model, GLuint depthVao = 0);
+	int size() const { return (int)items.size(); }
+
+protected:
+	friend class RenderQueue;
+
+	struct SortEntry
+	{
+		uint64_t key;
+		uint32_t item;
+	};
+
+	// Esvazia a lista; 'objects' (pode ser nullptr) tem lugar para 'capacity' matrizes a cada 'objectStride' bytes
+	void reset(const glm::mat4& view, float farPlane, char* objects, GLintptr objectOffset, GLsizeiptr objectStride, int capacity);
+	// Radix sort LSD de 8 bits por passo; pula os bytes iguais em todas as chaves
+	void sort();
+
+	glm::mat4 view;
+	float farPlane;
+	std::vector<RenderItem> items;
+	std::vector<SortEntry> entries, scratch;
+	char* objects;
+	GLintptr objectOffset;
+	GLsizeiptr objectStride;
+	int capacity;
+};
+
+// Trocas de estado de um flush: as feitas de fato e as que a ordem de
+// submisso teria causado (s calculadas com as estatsticas ligadas)
+struct RenderQueueStats
+{
+	int items = 0;
+	int programChanges = 0, textureChanges = 0, vaoChanges = 0;
+	int unsortedProgramChanges = 0, unsortedTextureChanges = 0, unsortedVaoChanges = 0;
+
+	int changes() const { return programChanges + textureChanges + vaoChanges; }
+	int unsortedChanges() const { return unsortedProgramChanges + unsortedTextureChanges + unsortedVaoChanges; }
+	int avoided() const { return unsortedChanges() - changes(); }
+	void add(const RenderQueueStats& other);
+};
+
+// Pr-passo de profundidade dos opacos
+enum DepthPrepassMode
+{
+	PREPASS_OFF,
+	PREPASS_ON,
+	PREPASS_AUTO //Liga e desliga conforme o overdraw medido
+};
+
+// Overdraw dos opacos medido com GL_SAMPLES_PASSED (resultados de alguns quadros atrs)
+struct OverdrawStats
+{
+	GLuint64 shaded = 0; //Fragmentos que passam no teste de profundidade sem o pr-passo
+	GLuint64 visible = 0; //Fragmentos que passam no GL_EQUAL depois do pr-passo
+	double overdraw = 0.0; //shaded / visible
+	int frames = 0, prepassFrames = 0;
+	int toggles = 0; //Vezes que o modo automtico ligou ou desligou
+};
+
+// Fila de desenho ordenada por chave. Cada submit() grava uma chave de 64 bits
+// e o item; no flush() as chaves so ordenadas (radix sort) e os itens saem
+// agrupados por passada, variante do shader, textura e VAO, trocando de estado
+// s quando a chave muda. Os opacos saem da frente para trs (menos overdraw)
+// e os transparentes de trs para a frente (blend correto). Layout da chave:
+//   opacos:        passada(2) | variante(8) | textura(14) | VAO(16) | profundidade(24)
+//   transparentes: passada(2) | profundidade invertida(24) | variante(8) | textura(14) | VAO(16)
+// Textura e VAO entram s pelos bits baixos do nome; uma coliso s piora o
+// agrupamento, o estado de cada item sempre vem do prprio item.
+// Com um StreamBuffer as matrizes model saem todas num pedao dele, e cada
+// desenho s liga o seu trecho (glBindBufferRange) em vez de um glUniformMatrix4fv.
+//
+// Alm do submit() na thread do GL, record() grava em paralelo: cada bloco
+// do jobSystem preenche a sua CommandList (culling, chave, ordenao e cpia
+// das matrizes ficam nas threads de trabalho) e o flush() intercala as listas
+// ordenadas num fluxo s de comandos, que a thread do GL percorre trocando
+// estado e desenhando.
+class RenderQueue
+{
+public:
+	RenderQueue();
+
+	// Comea um quadro: esvazia a fila e guarda a cmera usada para a profundidade
+	void begin(const glm::mat4& view, float farPlane);
+	void submit(RenderPass pass, GLuint vao, GLsizei indexCount, const Material& material, const glm::mat4& model, GLuint depthVao = 0);
+	// Chama job(list, begin, end) nas threads do jobSystem para blocos de at 'grain' de [0, count),
+	// cada bloco com a sua CommandList. Cada ndice pode gerar no mximo um item.
+	typedef std::function<void(CommandList& list, int begin, int end)> RecordJob;
+	void record(int count, int grain, const RecordJob& job);
+	// Ordena e desenha tudo. 'setupShader'  chamado a cada troca de programa, com a
+	// variante j ativa, para os uniforms do quadro (view, projection, luz...).
+	// Com 'resolveOpaque' os opacos saem na variante GBUFFER (para o G-buffer do
+	// DeferredRenderer) e ele  chamado entre os opacos e os transparentes.
+	void flush(ShaderVariantCache& shaders, const std::function<void(Shader*)>& setupShader,
+		const std::function<void()>& resolveOpaque = nullptr);
+
+	// Buffer de onde saem as matrizes dos objetos (nullptr = uniform model a cada desenho).
+	// O dono chama beginFrame()/endFrame() dele em volta do quadro.
+	void setStreamBuffer(StreamBuffer* stream) { this->stream = stream; }
+	// Features somadas s dos materiais iluminados (ex.: SHADER_CLUSTERED)
+	void setLightingFeatures(unsigned features) { lightingFeatures = features; }
+
+	// Pr-passo de profundidade: os opacos so desenhados antes s com a posio
+	// e um programa trivial ('depthShaders', shaders/depth.vs), e o passo
+	// principal testa com GL_EQUAL sem escrever profundidade, ento o fragment
+	// shader caro roda uma vez por pixel. Vale a pena quando h muito overdraw;
+	// no PREPASS_AUTO o overdraw  medido com GL_SAMPLES_PASSED em volta dos
+	// opacos e o pr-passo liga acima de 1,5 fragmento por pixel e desliga abaixo
+	// de 1,2. Precisa do contexto para as queries.
+	void setDepthPrepass(ShaderVariantCache* depthShaders, DepthPrepassMode mode);
+	DepthPrepassMode depthPrepassMode() const { return prepassMode; }
+	// Se o ltimo flush() fez o pr-passo
+	bool depthPrepassActive() const { return prepassActive; }
+	const OverdrawStats& overdrawStats() const { return overdraw; }
+	// Apaga as queries (chamar com o contexto ainda ativo)
+	void release();
+
+	static uint64_t makeKey(RenderPass pass, unsigned features, GLuint texture, GLuint vao, float depth);
+
+	// Itens gravados no quadro (submit() e record())
+	int size() const;
+
+	// Liga a contagem das trocas que a ordem de submisso teria causado
+	void setStatsEnabled(bool enabled) { statsOn = enabled; }
+	bool statsEnabled() const { return statsOn; }
+	const RenderQueueStats& frameStats() const { return lastFrame; }
+	const RenderQueueStats& totalStats() const { return total; }
+
+protected:
+	// Intercala as listas ordenadas em 'commands'
+	void merge();
+	// Trocas de programa, textura e VAO que os itens causariam na ordem de submisso
+	void countUnsortedChanges(RenderQueueStats& stats) const;
+	// L as queries e decide se este quadro tem pr-passo
+	bool updateDepthPrepass();
+	// Profundidade de todos os opacos, sem escrever cor
+	void drawDepthPrepass(const std::function<void(Shader*)>& setupShader);
+
+	struct DrawCommand
+	{
+		uint64_t key;
+		const RenderItem* item;
+	};
+
+	glm::mat4 view;
+	float farPlane;
+	CommandList main; //Itens do submit()
+	std::vector<CommandList> lists; //Blocos do record(), os primeiros 'activeLists' em uso
+	int activeLists;
+	std::vector<DrawCommand> commands;
+	bool statsOn;
+	unsigned lightingFeatures;
+	StreamBuffer* stream;
+	RenderQueueStats lastFrame, total;
+
+	ShaderVariantCache* depthShaders;
+	DepthPrepassMode prepassMode;
+	bool prepassActive;
+	bool autoPrepass; //Estado do PREPASS_AUTO (com histerese)
+	// Fragmentos do pr-passo, do passo opaco sem pr-passo (sombreados) e com ele (visveis);
+	// a sonda dos visveis tem a prpria query para no disputar a fila com as outras
+	GpuQuery prepassSamples, opaqueSamples, visibleSamples;
+	OverdrawStats overdraw;
+};
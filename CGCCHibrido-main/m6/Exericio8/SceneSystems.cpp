@@ -0,0 +1,239 @@
+#include "SceneSystems.h"
+
+#include <atomic>
+#include <cstdint>
+#include <algorithm>
+
+//GLM
+#include <glm/gtc/type_ptr.hpp>
+
+#include "GLState.h"
+#include "Geometry.h"
+#include "Material.h"
+#include "OcclusionCuller.h"
+#include "ClusteredLighting.h"
+#include "RenderQueue.h"
+#include "Profiler.h"
+
+Entity createTransformEntity(Registry& registry, TransformHierarchy& transforms, Entity parent, const glm::vec3& position,
+	const glm::quat& rotation, const glm::vec3& scale)
+{
+	int parentNode = TRANSFORM_NONE;
+	if (parent != ENTITY_NONE)
+		parentNode = registry.get<Transform>(parent)->node;
+	Entity entity = registry.create();
+	Transform transform;
+	transform.node = transforms.create(parentNode, position, rotation, scale);
+	registry.add(entity, transform);
+	return entity;
+}
+
+Entity createMeshEntity(Registry& registry, TransformHierarchy& transforms, SceneTree& tree, Entity parent,
+	const GeometryBuffers& buffers, const Geometry& geometry, const Material* material, const glm::vec3& position,
+	const glm::quat& rotation, const glm::vec3& scale)
+{
+	Entity entity = createTransformEntity(registry, transforms, parent, position, rotation, scale);
+
+	MeshRef mesh;
+	mesh.vao = buffers.vao;
+	mesh.depthVao = buffers.depthVao;
+	mesh.indexCount = buffers.indexCount;
+	registry.add(entity, mesh);
+
+	MaterialRef materialRef;
+	materialRef.material = material;
+	registry.add(entity, materialRef);
+
+	// O mundo de verdade s sai no primeiro updateWorldBounds
+	Bounds bounds;
+	bounds.local = bounds.world = geometry.bounds;
+	bounds.localSphere = bounds.worldSphere = geometry.sphere;
+	bounds.proxyId = tree.createProxy(bounds.world, (void*)(uintptr_t)entity);
+	registry.add(entity, bounds);
+	return entity;
+}
+
+MotionState& addMotionState(Registry& registry, const TransformHierarchy& transforms, Entity entity)
+{
+	int node = registry.get<Transform>(entity)->node;
+	MotionState motion;
+	motion.position = motion.previousPosition = transforms.getPosition(node);
+	motion.rotation = motion.previousRotation = transforms.getRotation(node);
+	motion.scale = motion.previousScale = transforms.getScale(node);
+	return registry.add(entity, motion);
+}
+
+void saveMotionStates(Registry& registry)
+{
+	registry.each<MotionState>([&](Entity, MotionState& motion) {
+		motion.previousPosition = motion.position;
+		motion.previousRotation = motion.rotation;
+		motion.previousScale = motion.scale;
+	});
+}
+
+void integrateVelocities(Registry& registry, float dt)
+{
+	registry.each<Velocity, MotionState>([&](Entity, Velocity& velocity, MotionState& motion) {
+		motion.position += velocity.linear * dt;
+		float speed = glm::length(velocity.angular);
+		if (speed > 0.0f)
+		{
+			glm::quat step = glm::angleAxis(speed * dt, velocity.angular / speed);
+			motion.rotation = glm::normalize(step * motion.rotation);
+		}
+	});
+}
+
+void interpolateMotion(Registry& registry, TransformHierarchy& transforms, float alpha)
+{
+	registry.each<MotionState, Transform>([&](Entity, MotionState& motion, Transform& transform) {
+		// O que no mudou desde o passo anterior fica exato, sem conta
+		glm::vec3 position = motion.position, scale = motion.scale;
+		glm::quat rotation = motion.rotation;
+		if (position != motion.previousPosition)
+			position = glm::mix(motion.previousPosition, motion.position, alpha);
+		if (rotation != motion.previousRotation)
+			rotation = glm::slerp(motion.previousRotation, motion.rotation, alpha);
+		if (scale != motion.previousScale)
+			scale = glm::mix(motion.previousScale, motion.scale, alpha);
+		// Parado: o n no fica sujo e a hierarquia no recalcula a subrvore
+		int node = transform.node;
+		if (position != transforms.getPosition(node) || rotation != transforms.getRotation(node) || scale != transforms.getScale(node))
+			transforms.setLocal(node, position, rotation, scale);
+	});
+}
+
+void updateWorldBounds(Registry& registry, const TransformHierarchy& transforms, SceneTree& tree)
+{
+	// Cada entidade s mexe nos prprios Bounds
+	registry.eachParallel<Bounds, Transform>(1024, [&](Entity, Bounds& bounds, Transform& transform) {
+		const glm::mat4& world = transforms.world(transform.node);
+		glm::vec3 center = bounds.world.center();
+		bounds.world = bounds.local.transformed(world);
+		bounds.worldSphere = bounds.localSphere.transformed(world);
+		bounds.displacement = bounds.world.center() - center;
+	});
+
+	// A rvore no aceita escritas em paralelo; quem ainda cabe na caixa folgada sai logo no teste
+	PROFILE_ZONE("SceneTree");
+	registry.each<Bounds>([&](Entity, Bounds& bounds) {
+		if (bounds.proxyId != SCENE_TREE_NULL)
+			tree.moveProxy(bounds.proxyId, bounds.world, bounds.displacement);
+	});
+	tree.maintain();
+}
+
+void collectVisible(const SceneTree& tree, const Frustum& frustum, std::vector<Entity>& visible)
+{
+	visible.clear();
+	tree.queryFrustum(frustum, [&](int proxyId) {
+		visible.push_back((Entity)(uintptr_t)tree.getUserData(proxyId));
+		return true;
+	});
+}
+
+Entity pickEntity(Registry& registry, const SceneTree& tree, const SceneRay& ray, float& fraction)
+{
+	Entity picked = ENTITY_NONE;
+	fraction = ray.maxFraction;
+	// A rvore s tem as caixas folgadas: cada folha atingida  conferida pela caixa de mundo
+	// do objeto, e um acerto encurta o raio para descartar o que est atrs dele
+	tree.rayCast(ray, [&](int proxyId, const SceneRay& subRay) {
+		Entity entity = (Entity)(uintptr_t)tree.getUserData(proxyId);
+		const AABB& box = registry.get<Bounds>(entity)->world;
+		glm::vec3 t1 = (box.min - subRay.origin) / subRay.direction, t2 = (box.max - subRay.origin) / subRay.direction;
+		glm::vec3 tNear = glm::min(t1, t2), tFar = glm::max(t1, t2);
+		float enter = std::max(std::max(tNear.x, tNear.y), std::max(tNear.z, 0.0f));
+		float exit = std::min(std::min(tFar.x, tFar.y), tFar.z);
+		if (enter > exit || enter > subRay.maxFraction)
+			return -1.0f;
+		picked = entity;
+		fraction = enter;
+		return std::max(enter, 1e-6f);
+	});
+	return picked;
+}
+
+void collectLights(Registry& registry, const TransformHierarchy& transforms, ClusteredLighting& lighting)
+{
+	lighting.clear();
+	registry.each<PointLight, Transform>([&](Entity, PointLight& light, Transform& transform) {
+		lighting.addLight(glm::vec3(transforms.world(transform.node)[3]), light.radius, light.color, light.intensity);
+	});
+}
+
+void drawShadowCasters(Registry& registry, const TransformHierarchy& transforms, const SceneTree& tree, Shader* shader, bool staticCasters,
+	const glm::mat4& lightViewProjection)
+{
+	Frustum cascade = Frustum::fromMatrix(lightViewProjection);
+	tree.queryFrustum(cascade, [&](int proxyId) {
+		Entity entity = (Entity)(uintptr_t)tree.getUserData(proxyId);
+		// A caixa folgada pode tocar a cascata sem o objeto tocar
+		if (registry.has<StaticMesh>(entity) != staticCasters || !cascade.intersects(registry.get<Bounds>(entity)->world))
+			return true;
+		const MeshRef& mesh = *registry.get<MeshRef>(entity);
+		shader->setMat4("model", glm::value_ptr(transforms.world(registry.get<Transform>(entity)->node)));
+		// O shader de sombra s l a posio
+		glState.bindVertexArray(mesh.depthVao != 0 ? mesh.depthVao : mesh.vao);
+		glDrawElements(GL_TRIANGLES, mesh.indexCount, GL_UNSIGNED_INT, 0);
+		PROFILE_DRAW(mesh.indexCount / 3);
+		return true;
+	});
+}
+
+int submitVisible(Registry& registry, const TransformHierarchy& transforms, const std::vector<Entity>& visible, OcclusionCuller* occlusion,
+	const glm::mat4& viewProjection, RenderQueue& queue)
+{
+	if (occlusion)
+	{
+		PROFILE_ZONE("Oclusao");
+		occlusion->beginFrame(viewProjection);
+		// S os marcados como Occluder e grandes o bastante na tela; o resto s  testado
+		for (Entity entity : visible)
+		{
+			const Occluder* occluder = registry.get<Occluder>(entity);
+			if (!occluder || !occluder->geometry
+				|| occlusion->screenSize(registry.get<Bounds>(entity)->worldSphere) < OcclusionCuller::MIN_OCCLUDER_SIZE)
+				continue;
+			occlusion->addOccluder(*occluder->geometry, transforms.world(registry.get<Transform>(entity)->node));
+		}
+		occlusion->rasterize();
+	}
+
+	// Cada bloco da lista de visveis vira uma CommandList gravada numa thread de trabalho:
+	// testes de ocluso, chave de ordenao e cpia da matriz saem da thread do GL
+	std::atomic<int> submitted(0), tested(0), hidden(0);
+	// Os pools so criados aqui, antes das threads
+	ComponentPool<Bounds>& boundsPool = registry.pool<Bounds>();
+	ComponentPool<MeshRef>& meshPool = registry.pool<MeshRef>();
+	ComponentPool<MaterialRef>& materialPool = registry.pool<MaterialRef>();
+	ComponentPool<Transform>& transformPool = registry.pool<Transform>();
+	queue.record((int)visible.size(), 512, [&](CommandList& list, int begin, int end) {
+		int listTested = 0, listHidden = 0;
+		for (int i = begin; i < end; i++)
+		{
+			Entity entity = visible[i];
+			const Bounds& bounds = *boundsPool.get(entity);
+			const MeshRef& mesh = *meshPool.get(entity);
+			if (occlusion)
+			{
+				listTested++;
+				if (!occlusion->testBox(bounds.world))
+				{
+					listHidden++;
+					continue;
+				}
+			}
+			const Material& material = *materialPool.get(entity)->material;
+			list.submit(material.transparent() ? PASS_TRANSPARENT : PASS_OPAQUE, mesh.vao, mesh.indexCount, material,
+				transforms.world(transformPool.get(entity)->node), mesh.depthVao);
+		}
+		submitted += list.size();
+		tested += listTested;
+		hidden += listHidden;
+	});
+	if (occlusion)
+		occlusion->countTests(tested, hidden);
+	return submitted;
+}
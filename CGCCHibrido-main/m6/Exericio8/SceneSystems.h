@@ -0,0 +1,59 @@
+#pragma once
+
+//GLM
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include <vector>
+
+#include "ECS.h"
+#include "Components.h"
+#include "TransformHierarchy.h"
+#include "SceneTree.h"
+
+struct Geometry;
+struct GeometryBuffers;
+class OcclusionCuller;
+class RenderQueue;
+class ClusteredLighting;
+class Shader;
+
+// Entidade s com Transform (pivs, grupos), filha de 'parent' (ENTITY_NONE = raiz)
+Entity createTransformEntity(Registry& registry, TransformHierarchy& transforms, Entity parent, const glm::vec3& position,
+	const glm::quat& rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f), const glm::vec3& scale = glm::vec3(1.0f));
+// Objeto desenhvel: Transform + MeshRef + MaterialRef + Bounds, j com a caixa no ndice da cena
+// (a entidade  o userData do proxy)
+Entity createMeshEntity(Registry& registry, TransformHierarchy& transforms, SceneTree& tree, Entity parent,
+	const GeometryBuffers& buffers, const Geometry& geometry, const Material* material, const glm::vec3& position,
+	const glm::quat& rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f), const glm::vec3& scale = glm::vec3(1.0f));
+
+// Pe um MotionState na entidade, comeando no local atual do Transform
+MotionState& addMotionState(Registry& registry, const TransformHierarchy& transforms, Entity entity);
+
+// Sistemas (l -> escreve)
+
+// MotionState -> MotionState: o estado atual vira o anterior (no comeo de cada passo fixo)
+void saveMotionStates(Registry& registry);
+// Velocity -> MotionState: soma o deslocamento e a rotao de 'dt' segundos (um passo fixo)
+void integrateVelocities(Registry& registry, float dt);
+// MotionState -> Transform: local entre o passo anterior (alpha = 0) e o atual (alpha = 1)
+void interpolateMotion(Registry& registry, TransformHierarchy& transforms, float alpha);
+// Transform -> Bounds: limites de mundo pela matriz do ltimo transforms.update(); depois move
+// as caixas na rvore e chama tree.maintain() (uma vez por quadro)
+void updateWorldBounds(Registry& registry, const TransformHierarchy& transforms, SceneTree& tree);
+// rvore -> lista: as entidades cuja caixa folgada toca o frustum
+void collectVisible(const SceneTree& tree, const Frustum& frustum, std::vector<Entity>& visible);
+// Bounds -> entidade: a mais prxima cuja caixa de mundo o raio atravessa (ENTITY_NONE se nenhuma),
+// com 'fraction' (0 a ray.maxFraction) do ponto de entrada
+Entity pickEntity(Registry& registry, const SceneTree& tree, const SceneRay& ray, float& fraction);
+// Transform, PointLight -> luzes: refaz a lista de luzes com as posies de mundo atuais
+void collectLights(Registry& registry, const TransformHierarchy& transforms, ClusteredLighting& lighting);
+// Transform, MeshRef, Bounds -> mapa de sombra: desenha com 'shader' os objetos estticos (StaticMesh)
+// ou os dinmicos que a rvore acha no volume da cascata (CascadedShadows::DrawCasters)
+void drawShadowCasters(Registry& registry, const TransformHierarchy& transforms, const SceneTree& tree, Shader* shader, bool staticCasters,
+	const glm::mat4& lightViewProjection);
+// Transform, MeshRef, MaterialRef, Bounds, Occluder -> fila: grava em paralelo (RenderQueue::record)
+// as entidades de 'visible' (collectVisible) que passam, com 'occlusion', no teste contra os
+// Occluder visveis e grandes na tela, rasterizados antes. Retorna quantas entraram na fila.
+int submitVisible(Registry& registry, const TransformHierarchy& transforms, const std::vector<Entity>& visible, OcclusionCuller* occlusion,
+	const glm::mat4& viewProjection, RenderQueue& queue);
@@ -0,0 +1,497 @@
+#include "SceneTree.h"
+
+#include <algorithm>
+
+#include "Profiler.h"
+
+// Bins por eixo na reconstruo SAH
+static const int SAH_BINS = 12;
+
+static AABB fatten(const AABB& box, float margin)
+{
+	AABB fat;
+	fat.min = box.min - glm::vec3(margin);
+	fat.max = box.max + glm::vec3(margin);
+	return fat;
+}
+
+SceneTree::SceneTree() : root(SCENE_TREE_NULL), freeList(SCENE_TREE_NULL), proxies(0), builtRatio(0.0f), refitsSinceBuild(0)
+{
+}
+
+int SceneTree::allocateNode()
+{
+	if (freeList == SCENE_TREE_NULL)
+	{
+		// Pool cheio: dobra e encadeia os ns novos na lista de livres
+		int oldCapacity = (int)nodes.size();
+		int capacity = std::max(16, oldCapacity * 2);
+		nodes.resize(capacity);
+		for (int i = oldCapacity; i < capacity; i++)
+		{
+			nodes[i].next = i + 1 < capacity ? i + 1 : SCENE_TREE_NULL;
+			nodes[i].height = -1;
+		}
+		freeList = oldCapacity;
+	}
+
+	int nodeId = freeList;
+	SceneTreeNode& node = nodes[nodeId];
+	freeList = node.next;
+	node.parent = SCENE_TREE_NULL;
+	node.child1 = SCENE_TREE_NULL;
+	node.child2 = SCENE_TREE_NULL;
+	node.height = 0;
+	node.userData = nullptr;
+	node.moved = false;
+	return nodeId;
+}
+
+void SceneTree::freeNode(int nodeId)
+{
+	nodes[nodeId].next = freeList;
+	nodes[nodeId].height = -1;
+	freeList = nodeId;
+}
+
+int SceneTree::createProxy(const AABB& box, void* userData)
+{
+	int proxyId = allocateNode();
+	SceneTreeNode& node = nodes[proxyId];
+	node.box = fatten(box, EXTENSION);
+	node.userData = userData;
+	node.height = 0;
+	node.moved = true;
+	insertLeaf(proxyId);
+	proxies++;
+	return proxyId;
+}
+
+void SceneTree::destroyProxy(int proxyId)
+{
+	removeLeaf(proxyId);
+	freeNode(proxyId);
+	proxies--;
+}
+
+bool SceneTree::moveProxy(int proxyId, const AABB& box, const glm::vec3& displacement)
+{
+	// Caixa folgada nova, esticada na direo do movimento
+	AABB fat = fatten(box, EXTENSION);
+	glm::vec3 d = MULTIPLIER * displacement;
+	for (int axis = 0; axis < 3; axis++)
+	{
+		if (d[axis] < 0.0f)
+			fat.min[axis] += d[axis];
+		else
+			fat.max[axis] += d[axis];
+	}
+
+	const AABB& treeBox = nodes[proxyId].box;
+	if (treeBox.contains(box))
+	{
+		// Ainda cabe; s mexe se a caixa da rvore ficou grande demais para o objeto
+		AABB huge = fatten(fat, 4.0f * EXTENSION);
+		if (huge.contains(treeBox))
+			return false;
+	}
+
+	nodes[proxyId].box = fat;
+	nodes[proxyId].moved = true;
+	refitAncestors(nodes[proxyId].parent, false);
+	refitsSinceBuild++;
+	return true;
+}
+
+void SceneTree::insertLeaf(int leaf)
+{
+	if (root == SCENE_TREE_NULL)
+	{
+		root = leaf;
+		nodes[root].parent = SCENE_TREE_NULL;
+		return;
+	}
+
+	// Desce escolhendo o lado que aumenta menos a rea total
+	AABB leafBox = nodes[leaf].box;
+	int index = root;
+	while (!nodes[index].isLeaf())
+	{
+		int child1 = nodes[index].child1;
+		int child2 = nodes[index].child2;
+
+		float area = nodes[index].box.surfaceArea();
+		float combinedArea = AABB::merge(nodes[index].box, leafBox).surfaceArea();
+
+		// Custo de criar um pai novo para este n e a folha
+		float cost = 2.0f * combinedArea;
+		// Custo mnimo de empurrar a folha mais para baixo
+		float inheritanceCost = 2.0f * (combinedArea - area);
+
+		float cost1 = AABB::merge(leafBox, nodes[child1].box).surfaceArea() + inheritanceCost;
+		if (!nodes[child1].isLeaf())
+			cost1 -= nodes[child1].box.surfaceArea();
+		float cost2 = AABB::merge(leafBox, nodes[child2].box).surfaceArea() + inheritanceCost;
+		if (!nodes[child2].isLeaf())
+			cost2 -= nodes[child2].box.surfaceArea();
+
+		if (cost < cost1 && cost < cost2)
+			break;
+		index = cost1 < cost2 ? child1 : child2;
+	}
+
+	int sibling = index;
+	int oldParent = nodes[sibling].parent;
+	int newParent = allocateNode();
+	nodes[newParent].parent = oldParent;
+	nodes[newParent].box = AABB::merge(leafBox, nodes[sibling].box);
+	nodes[newParent].height = nodes[sibling].height + 1;
+	nodes[newParent].child1 = sibling;
+	nodes[newParent].child2 = leaf;
+	nodes[sibling].parent = newParent;
+	nodes[leaf].parent = newParent;
+
+	if (oldParent != SCENE_TREE_NULL)
+	{
+		if (nodes[oldParent].child1 == sibling)
+			nodes[oldParent].child1 = newParent;
+		else
+			nodes[oldParent].child2 = newParent;
+	}
+	else
+		root = newParent;
+
+	refitAncestors(nodes[leaf].parent, true);
+}
+
+void SceneTree::removeLeaf(int leaf)
+{
+	if (leaf == root)
+	{
+		root = SCENE_TREE_NULL;
+		return;
+	}
+
+	int parent = nodes[leaf].parent;
+	int grandParent = nodes[parent].parent;
+	int sibling = nodes[parent].child1 == leaf ? nodes[parent].child2 : nodes[parent].child1;
+
+	if (grandParent != SCENE_TREE_NULL)
+	{
+		// O irmo ocupa o lugar do pai
+		if (nodes[grandParent].child1 == parent)
+			nodes[grandParent].child1 = sibling;
+		else
+			nodes[grandParent].child2 = sibling;
+		nodes[sibling].parent = grandParent;
+		freeNode(parent);
+		refitAncestors(grandParent, true);
+	}
+	else
+	{
+		root = sibling;
+		nodes[sibling].parent = SCENE_TREE_NULL;
+		freeNode(parent);
+	}
+}
+
+void SceneTree::refitAncestors(int index, bool rotate)
+{
+	while (index != SCENE_TREE_NULL)
+	{
+		if (rotate)
+			index = balance(index);
+
+		int child1 = nodes[index].child1;
+		int child2 = nodes[index].child2;
+		nodes[index].height = 1 + std::max(nodes[child1].height, nodes[child2].height);
+		nodes[index].box = AABB::merge(nodes[child1].box, nodes[child2].box);
+		index = nodes[index].parent;
+	}
+}
+
+int SceneTree::balance(int iA)
+{
+	SceneTreeNode* A = &nodes[iA];
+	if (A->isLeaf() || A->height < 2)
+		return iA;
+
+	int iB = A->child1;
+	int iC = A->child2;
+	SceneTreeNode* B = &nodes[iB];
+	SceneTreeNode* C = &nodes[iC];
+
+	int balance = C->height - B->height;
+
+	// Sobe o C
+	if (balance > 1)
+	{
+		int iF = C->child1;
+		int iG = C->child2;
+		SceneTreeNode* F = &nodes[iF];
+		SceneTreeNode* G = &nodes[iG];
+
+		// Troca A e C
+		C->child1 = iA;
+		C->parent = A->parent;
+		A->parent = iC;
+
+		// O antigo pai de A passa a apontar para C
+		if (C->parent != SCENE_TREE_NULL)
+		{
+			if (nodes[C->parent].child1 == iA)
+				nodes[C->parent].child1 = iC;
+			else
+				nodes[C->parent].child2 = iC;
+		}
+		else
+			root = iC;
+
+		// Rotaciona
+		if (F->height > G->height)
+		{
+			C->child2 = iF;
+			A->child2 = iG;
+			G->parent = iA;
+			A->box = AABB::merge(B->box, G->box);
+			C->box = AABB::merge(A->box, F->box);
+			A->height = 1 + std::max(B->height, G->height);
+			C->height = 1 + std::max(A->height, F->height);
+		}
+		else
+		{
+			C->child2 = iG;
+			A->child2 = iF;
+			F->parent = iA;
+			A->box = AABB::merge(B->box, F->box);
+			C->box = AABB::merge(A->box, G->box);
+			A->height = 1 + std::max(B->height, F->height);
+			C->height = 1 + std::max(A->height, G->height);
+		}
+		return iC;
+	}
+
+	// Sobe o B
+	if (balance < -1)
+	{
+		int iD = B->child1;
+		int iE = B->child2;
+		SceneTreeNode* D = &nodes[iD];
+		SceneTreeNode* E = &nodes[iE];
+
+		// Troca A e B
+		B->child1 = iA;
+		B->parent = A->parent;
+		A->parent = iB;
+
+		// O antigo pai de A passa a apontar para B
+		if (B->parent != SCENE_TREE_NULL)
+		{
+			if (nodes[B->parent].child1 == iA)
+				nodes[B->parent].child1 = iB;
+			else
+				nodes[B->parent].child2 = iB;
+		}
+		else
+			root = iB;
+
+		// Rotaciona
+		if (D->height > E->height)
+		{
+			B->child2 = iD;
+			A->child1 = iE;
+			E->parent = iA;
+			A->box = AABB::merge(C->box, E->box);
+			B->box = AABB::merge(A->box, D->box);
+			A->height = 1 + std::max(C->height, E->height);
+			B->height = 1 + std::max(A->height, D->height);
+		}
+		else
+		{
+			B->child2 = iE;
+			A->child1 = iD;
+			D->parent = iA;
+			A->box = AABB::merge(C->box, D->box);
+			B->box = AABB::merge(A->box, E->box);
+			A->height = 1 + std::max(C->height, D->height);
+			B->height = 1 + std::max(A->height, E->height);
+		}
+		return iB;
+	}
+
+	return iA;
+}
+
+float SceneTree::areaRatio() const
+{
+	if (root == SCENE_TREE_NULL)
+		return 0.0f;
+
+	float rootArea = nodes[root].box.surfaceArea();
+	float totalArea = 0.0f;
+	for (const SceneTreeNode& node : nodes)
+	{
+		// S os ns internos: as folhas tm a mesma rea em qualquer rvore
+		if (node.height > 0)
+			totalArea += node.box.surfaceArea();
+	}
+	return rootArea > 0.0f ? totalArea / rootArea : 0.0f;
+}
+
+bool SceneTree::maintain(float maxGrowth)
+{
+	// Medir a rvore custa O(n); s vale a pena depois de uma parte dos objetos ter se mexido
+	if (refitsSinceBuild < std::max(16, proxies / 8))
+		return false;
+
+	if (areaRatio() <= builtRatio * maxGrowth)
+	{
+		refitsSinceBuild = 0;
+		return false;
+	}
+	rebuild();
+	return true;
+}
+
+void SceneTree::rebuild()
+{
+	PROFILE_ZONE("SceneTree::rebuild");
+	std::vector<int> leaves;
+	leaves.reserve(proxies);
+	for (int i = 0; i < (int)nodes.size(); i++)
+	{
+		if (nodes[i].height == 0)
+			leaves.push_back(i);
+		else if (nodes[i].height > 0)
+			freeNode(i);
+	}
+
+	root = leaves.empty() ? SCENE_TREE_NULL : buildSAH(leaves, 0, (int)leaves.size());
+	if (root != SCENE_TREE_NULL)
+		nodes[root].parent = SCENE_TREE_NULL;
+	builtRatio = areaRatio();
+	refitsSinceBuild = 0;
+}
+
+int SceneTree::buildSAH(std::vector<int>& leaves, int begin, int end)
+{
+	if (end - begin == 1)
+		return leaves[begin];
+
+	// O eixo de diviso  o mais comprido da caixa dos centros
+	AABB centroids;
+	for (int i = begin; i < end; i++)
+		centroids.expand(nodes[leaves[i]].box.center());
+	glm::vec3 size = centroids.max - centroids.min;
+	int axis = (size.x > size.y && size.x > size.z) ? 0 : (size.y > size.z ? 1 : 2);
+	float extent = size[axis];
+
+	int mid = begin;
+	if (extent > 0.0f)
+	{
+		struct Bin
+		{
+			AABB box;
+			int count = 0;
+		};
+		Bin bins[SAH_BINS];
+		float scale = SAH_BINS / extent;
+		auto binOf = [&](int leaf) {
+			int b = (int)((nodes[leaf].box.center()[axis] - centroids.min[axis]) * scale);
+			return std::min(SAH_BINS - 1, b);
+		};
+		for (int i = begin; i < end; i++)
+		{
+			Bin& bin = bins[binOf(leaves[i])];
+			bin.box = AABB::merge(bin.box, nodes[leaves[i]].box);
+			bin.count++;
+		}
+
+		// Custo de cortar depois do bin i: rea * quantidade de cada lado
+		float rightCost[SAH_BINS];
+		AABB right;
+		int rightCount = 0;
+		for (int i = SAH_BINS - 1; i > 0; i--)
+		{
+			right = AABB::merge(right, bins[i].box);
+			rightCount += bins[i].count;
+			rightCost[i - 1] = rightCount > 0 ? right.surfaceArea() * rightCount : 0.0f;
+		}
+		AABB left;
+		int leftCount = 0;
+		float bestCost = 1e30f;
+		int bestSplit = -1;
+		for (int i = 0; i < SAH_BINS - 1; i++)
+		{
+			left = AABB::merge(left, bins[i].box);
+			leftCount += bins[i].count;
+			if (leftCount == 0 || leftCount == end - begin)
+				continue;
+			float cost = left.surfaceArea() * leftCount + rightCost[i];
+			if (cost < bestCost)
+			{
+				bestCost = cost;
+				bestSplit = i;
+			}
+		}
+
+		if (bestSplit >= 0)
+			mid = (int)(std::partition(leaves.begin() + begin, leaves.begin() + end, [&](int leaf) { return binOf(leaf) <= bestSplit; }) - leaves.begin());
+	}
+
+	// Centros todos iguais ou num bin s: divide ao meio pela mediana
+	if (mid == begin || mid == end)
+	{
+		mid = (begin + end) / 2;
+		std::nth_element(leaves.begin() + begin, leaves.begin() + mid, leaves.begin() + end, [&](int a, int b) {
+			return nodes[a].box.center()[axis] < nodes[b].box.center()[axis];
+		});
+	}
+
+	int child1 = buildSAH(leaves, begin, mid);
+	int child2 = buildSAH(leaves, mid, end);
+	int nodeId = allocateNode();
+	SceneTreeNode& node = nodes[nodeId];
+	node.child1 = child1;
+	node.child2 = child2;
+	node.box = AABB::merge(nodes[child1].box, nodes[child2].box);
+	node.height = 1 + std::max(nodes[child1].height, nodes[child2].height);
+	nodes[child1].parent = nodeId;
+	nodes[child2].parent = nodeId;
+	return nodeId;
+}
+
+bool SceneTree::rayHitsBox(const glm::vec3& origin, const glm::vec3& inverseDirection, float maxFraction, const AABB& box)
+{
+	// Mtodo dos slabs: intervalo de t dentro da caixa em cada eixo
+	glm::vec3 t1 = (box.min - origin) * inverseDirection;
+	glm::vec3 t2 = (box.max - origin) * inverseDirection;
+	glm::vec3 tNear = glm::min(t1, t2), tFar = glm::max(t1, t2);
+	float enter = std::max(std::max(tNear.x, tNear.y), std::max(tNear.z, 0.0f));
+	float exit = std::min(std::min(tFar.x, tFar.y), std::min(tFar.z, maxFraction));
+	return enter <= exit;
+}
+
+bool SceneTree::validate() const
+{
+	if (root == SCENE_TREE_NULL)
+		return proxies == 0;
+	return nodes[root].parent == SCENE_TREE_NULL && validate(root);
+}
+
+bool SceneTree::validate(int index) const
+{
+	const SceneTreeNode& node = nodes[index];
+	if (node.isLeaf())
+		return node.height == 0;
+
+	const SceneTreeNode& child1 = nodes[node.child1];
+	const SceneTreeNode& child2 = nodes[node.child2];
+	if (child1.parent != index || child2.parent != index)
+		return false;
+	if (node.height != 1 + std::max(child1.height, child2.height))
+		return false;
+	if (!node.box.contains(child1.box) || !node.box.contains(child2.box))
+		return false;
+	return validate(node.child1) && validate(node.child2);
+}
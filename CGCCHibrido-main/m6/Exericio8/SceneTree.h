@@ -0,0 +1,278 @@
+#pragma once
+
+#include <vector>
+
+//GLM
+#include <glm/glm.hpp>
+
+#include "Bounds.h"
+#include "FrustumCuller.h"
+
+#define SCENE_TREE_NULL (-1)
+
+// N da rvore. Folhas guardam um objeto; ns internos, a unio dos dois filhos.
+struct SceneTreeNode
+{
+	bool isLeaf() const { return child1 == SCENE_TREE_NULL; }
+
+	// Caixa folgada: maior que o objeto, para ele poder se mexer um pouco sem mexer na rvore
+	AABB box;
+	void* userData;
+
+	union
+	{
+		int parent;
+		int next; //Na lista de ns livres
+	};
+
+	int child1;
+	int child2;
+
+	// Folha = 0, n livre = -1
+	int height;
+	bool moved;
+};
+
+// Pilha das consultas (o b2GrowableStack do Box2D): comea num vetor fixo dentro
+// da prpria funo e s vai para o heap se a descida passar de N entradas
+template <typename T, int N>
+class SceneTreeStack
+{
+public:
+	SceneTreeStack() : data(fixed), count(0), capacity(N) {}
+	SceneTreeStack(const SceneTreeStack&) = delete;
+	SceneTreeStack& operator=(const SceneTreeStack&) = delete;
+
+	void push(const T& value)
+	{
+		if (count == capacity)
+			grow();
+		data[count++] = value;
+	}
+	T pop() { return data[--count]; }
+	bool empty() const { return count == 0; }
+
+protected:
+	void grow()
+	{
+		if (data == fixed)
+			heap.assign(fixed, fixed + count);
+		capacity *= 2;
+		heap.resize(capacity);
+		data = heap.data();
+	}
+
+	T fixed[N];
+	std::vector<T> heap;
+	T* data;
+	int count;
+	int capacity;
+};
+
+// Raio para rayCast: vai de origin at origin + maxFraction * direction
+struct SceneRay
+{
+	glm::vec3 origin;
+	glm::vec3 direction;
+	float maxFraction = 1.0f;
+};
+
+// rvore dinmica de caixas (BVH) para o ndice espacial da cena, no mesmo
+// esquema do b2DynamicTree do Box2D, levado para 3D: ns num vetor com lista
+// de livres (os ids dos objetos so ndices e no mudam), caixas folgadas
+// (EXTENSION + previso do deslocamento) e insero que desce pelo filho de
+// menor custo de rea e rebalanceia com rotaes. A diferena  o moveProxy(): em
+// vez de remover e reinserir, a folha recebe a caixa nova e os ancestrais so
+// reajustados (refit), o que  barato mas vai piorando a rvore; maintain()
+// mede essa piora pela soma das reas e reconstri tudo com SAH quando passa
+// do limite. As consultas (frustum, esfera, caixa e raio) descem s pelos
+// ramos que tocam o volume, O(log n) mais o nmero de resultados.
+class SceneTree
+{
+public:
+	// Entradas da pilha das consultas antes de ir para o heap (sobra para rvores bem mais fundas que log2 dos objetos)
+	static const int STACK_SIZE = 256;
+	// Folga fixa em cada lado da caixa
+	static constexpr float EXTENSION = 0.1f;
+	// A caixa tambm se estende MULTIPLIER vezes o deslocamento do ltimo quadro
+	static constexpr float MULTIPLIER = 4.0f;
+
+	SceneTree();
+
+	// Cria um objeto com a caixa justa dele e devolve o id
+	int createProxy(const AABB& box, void* userData);
+	void destroyProxy(int proxyId);
+	// Atualiza a caixa de um objeto que se moveu 'displacement' desde a ltima vez.
+	// Se ainda cabe na caixa folgada nada muda; seno refaz a caixa e os ancestrais.
+	// Retorna true se a rvore mudou.
+	bool moveProxy(int proxyId, const AABB& box, const glm::vec3& displacement);
+
+	void* getUserData(int proxyId) const { return nodes[proxyId].userData; }
+	const AABB& getFatAABB(int proxyId) const { return nodes[proxyId].box; }
+	bool wasMoved(int proxyId) const { return nodes[proxyId].moved; }
+	void clearMoved(int proxyId) { nodes[proxyId].moved = false; }
+
+	// Reconstri com SAH se a rvore piorou mais que 'maxGrowth' vezes desde a ltima
+	// reconstruo (pela areaRatio). Chamar uma vez por quadro. Retorna true se reconstruiu.
+	bool maintain(float maxGrowth = 1.3f);
+	// Reconstruo completa de cima para baixo com SAH por bins; os ids no mudam
+	void rebuild();
+
+	// callback(proxyId) retorna false para parar a busca
+	template <typename Callback>
+	void queryAABB(const AABB& box, Callback callback) const;
+	template <typename Callback>
+	void querySphere(const BoundingSphere& sphere, Callback callback) const;
+	// Ramos inteiros dentro do frustum so aceitos sem testar as folhas
+	template <typename Callback>
+	void queryFrustum(const Frustum& frustum, Callback callback) const;
+	// callback(proxyId, ray) retorna a nova maxFraction: 0 para, < 0 ignora o objeto,
+	// e um valor positivo encurta o raio (para achar s o mais prximo)
+	template <typename Callback>
+	void rayCast(const SceneRay& ray, Callback callback) const;
+
+	int proxyCount() const { return proxies; }
+	int getHeight() const { return root == SCENE_TREE_NULL ? 0 : nodes[root].height; }
+	// Soma das reas dos ns internos dividida pela rea da raiz (menor = rvore melhor)
+	float areaRatio() const;
+	// Confere a estrutura e as caixas (lento, para depurao)
+	bool validate() const;
+
+protected:
+	int allocateNode();
+	void freeNode(int node);
+
+	void insertLeaf(int leaf);
+	void removeLeaf(int leaf);
+	// Rotao que diminui a diferena de altura entre os filhos de 'index'; retorna a nova raiz da subrvore
+	int balance(int index);
+	// Recalcula caixa e altura de 'index' at a raiz (rebalanceando no caminho quando 'rotate')
+	void refitAncestors(int index, bool rotate);
+
+	// Monta a subrvore das folhas leaves[begin, end) e devolve a raiz dela
+	int buildSAH(std::vector<int>& leaves, int begin, int end);
+	bool validate(int index) const;
+
+	static bool rayHitsBox(const glm::vec3& origin, const glm::vec3& inverseDirection, float maxFraction, const AABB& box);
+
+	int root;
+	std::vector<SceneTreeNode> nodes;
+	int freeList;
+	int proxies;
+	// areaRatio logo depois da ltima reconstruo, e quantos refits houve desde ento
+	float builtRatio;
+	int refitsSinceBuild;
+};
+
+template <typename Callback>
+inline void SceneTree::queryAABB(const AABB& box, Callback callback) const
+{
+	SceneTreeStack<int, STACK_SIZE> stack;
+	if (root != SCENE_TREE_NULL)
+		stack.push(root);
+
+	while (!stack.empty())
+	{
+		int nodeId = stack.pop();
+		const SceneTreeNode& node = nodes[nodeId];
+		if (!node.box.overlaps(box))
+			continue;
+		if (node.isLeaf())
+		{
+			if (!callback(nodeId))
+				return;
+			continue;
+		}
+		stack.push(node.child1);
+		stack.push(node.child2);
+	}
+}
+
+template <typename Callback>
+inline void SceneTree::querySphere(const BoundingSphere& sphere, Callback callback) const
+{
+	AABB box;
+	box.min = sphere.center - glm::vec3(sphere.radius);
+	box.max = sphere.center + glm::vec3(sphere.radius);
+	float radius2 = sphere.radius * sphere.radius;
+	// A caixa da esfera corta os ramos; a distncia at a caixa folgada decide as folhas
+	queryAABB(box, [&](int proxyId) {
+		const AABB& fat = nodes[proxyId].box;
+		glm::vec3 closest = glm::clamp(sphere.center, fat.min, fat.max);
+		glm::vec3 d = closest - sphere.center;
+		if (glm::dot(d, d) > radius2)
+			return true;
+		return callback(proxyId);
+	});
+}
+
+template <typename Callback>
+inline void SceneTree::queryFrustum(const Frustum& frustum, Callback callback) const
+{
+	// Cada entrada leva junto se o pai j estava inteiro dentro do frustum
+	struct Entry
+	{
+		int node;
+		bool inside;
+	};
+	SceneTreeStack<Entry, STACK_SIZE> stack;
+	if (root != SCENE_TREE_NULL)
+		stack.push({ root, false });
+
+	while (!stack.empty())
+	{
+		Entry entry = stack.pop();
+		const SceneTreeNode& node = nodes[entry.node];
+
+		bool inside = entry.inside;
+		if (!inside)
+		{
+			Frustum::Containment containment = frustum.classify(node.box);
+			if (containment == Frustum::OUTSIDE)
+				continue;
+			inside = containment == Frustum::INSIDE;
+		}
+		if (node.isLeaf())
+		{
+			if (!callback(entry.node))
+				return;
+			continue;
+		}
+		stack.push({ node.child1, inside });
+		stack.push({ node.child2, inside });
+	}
+}
+
+template <typename Callback>
+inline void SceneTree::rayCast(const SceneRay& ray, Callback callback) const
+{
+	glm::vec3 inverseDirection = 1.0f / ray.direction;
+	float maxFraction = ray.maxFraction;
+
+	SceneTreeStack<int, STACK_SIZE> stack;
+	if (root != SCENE_TREE_NULL)
+		stack.push(root);
+
+	while (!stack.empty())
+	{
+		int nodeId = stack.pop();
+		const SceneTreeNode& node = nodes[nodeId];
+		if (!rayHitsBox(ray.origin, inverseDirection, maxFraction, node.box))
+			continue;
+
+		if (node.isLeaf())
+		{
+			SceneRay subRay = ray;
+			subRay.maxFraction = maxFraction;
+			float value = callback(nodeId, subRay);
+			if (value == 0.0f)
+				return;
+			// O raio encurtado descarta os ramos mais distantes que o acerto
+			if (value > 0.0f)
+				maxFraction = value;
+			continue;
+		}
+		stack.push(node.child1);
+		stack.push(node.child2);
+	}
+}
@@ -14,6 +14,8 @@
 // GLFW
 #include <GLFW/glfw3.h>
 
+#include "GLState.h"
+
 using namespace std;
 
 class Shader
@@ -51,6 +53,13 @@ public:
 		{
 			std::cout << "ERROR::SHADER::FILE_NOT_SUCCESFULLY_READ" << std::endl;
 		}
+		compile(vertexCode, fragmentCode);
+	}
+	// Constructor for programs whose sources are built in memory (ex.: ShaderVariantCache)
+	Shader() : ID(0) {}
+	// Compiles and links the given sources into this->ID
+	bool compile(const std::string& vertexCode, const std::string& fragmentCode)
+	{
 		const GLchar* vShaderCode = vertexCode.c_str();
 		const GLchar * fShaderCode = fragmentCode.c_str();
 		// 2. Compile shaders
@@ -94,12 +103,12 @@ public:
 		// Delete the shaders as they're linked into our program now and no longer necessery
 		glDeleteShader(vertex);
 		glDeleteShader(fragment);
-
+		return success != 0;
 	}
 	// Uses the current shader
 	void Use()
 	{
-		glUseProgram(this->ID);
+		glState.useProgram(this->ID);
 	}
 
 	void setBool(const std::string& name, bool value) const
@@ -127,9 +136,14 @@ public:
 		glUniform4f(glGetUniformLocation(this->ID, name.c_str()), v1, v2, v3,v4);
 	}
 
-	void setMat4(const std::string& name, float *v) const
+	void setMat4(const std::string& name, const float *v) const
 	{
 		glUniformMatrix4fv(glGetUniformLocation(this->ID, name.c_str()), 1, GL_FALSE, v);
 	}
+
+	void setVec3Array(const std::string& name, int count, const float *v) const
+	{
+		glUniform3fv(glGetUniformLocation(this->ID, name.c_str()), count, v);
+	}
 };
 
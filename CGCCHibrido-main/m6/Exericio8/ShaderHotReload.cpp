@@ -0,0 +1,90 @@
+#include "ShaderHotReload.h"
+
+void ShaderHotReload::add(ShaderVariantCache* cache)
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		caches.push_back(cache);
+	}
+	watchDependencies(cache);
+}
+
+void ShaderHotReload::watchDependencies(ShaderVariantCache* cache)
+{
+	for (const std::string& file : preprocessor.dependencies(cache->vertexFile()))
+		watcher.watch(file);
+	for (const std::string& file : preprocessor.dependencies(cache->fragmentFile()))
+		watcher.watch(file);
+}
+
+void ShaderHotReload::start()
+{
+	watcher.start([this](const std::vector<std::string>& files) { onFilesChanged(files); });
+}
+
+void ShaderHotReload::stop()
+{
+	watcher.stop();
+}
+
+void ShaderHotReload::onFilesChanged(const std::vector<std::string>& files)
+{
+	std::set<std::string> roots;
+	for (const std::string& file : files)
+	{
+		std::set<std::string> affected = preprocessor.invalidate(file);
+		roots.insert(affected.begin(), affected.end());
+	}
+	if (roots.empty())
+		return;
+
+	std::vector<ShaderVariantCache*> affectedCaches;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		for (ShaderVariantCache* cache : caches)
+		{
+			if (roots.count(ShaderPreprocessor::normalize(cache->vertexFile())) || roots.count(ShaderPreprocessor::normalize(cache->fragmentFile())))
+				affectedCaches.push_back(cache);
+		}
+	}
+
+	for (ShaderVariantCache* cache : affectedCaches)
+	{
+		// A expanso (leitura dos arquivos e includes) acontece aqui, fora da thread de render
+		PendingReload reload = { cache, preprocessor.load(cache->vertexFile()), preprocessor.load(cache->fragmentFile()) };
+		// Um include novo pode ter aparecido na edio
+		watchDependencies(cache);
+
+		std::lock_guard<std::mutex> lock(mutex);
+		for (PendingReload& old : pending)
+		{
+			if (old.cache == cache)
+				old.cache = nullptr;
+		}
+		pending.push_back(reload);
+	}
+}
+
+int ShaderHotReload::update()
+{
+	std::vector<PendingReload> ready;
+	std::vector<ShaderVariantCache*> watched;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		ready.swap(pending);
+		watched = caches;
+	}
+
+	for (PendingReload& reload : ready)
+	{
+		if (reload.cache)
+			reload.cache->beginRebuild(reload.vertexSource, reload.fragmentSource);
+	}
+	int swapped = 0;
+	for (ShaderVariantCache* cache : watched)
+	{
+		if (cache->rebuilding())
+			swapped += cache->finishRebuild();
+	}
+	return swapped;
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <vector>
+#include <mutex>
+
+#include "FileWatcher.h"
+#include "ShaderPreprocessor.h"
+#include "ShaderVariants.h"
+
+// Recarrega shaders quando os arquivos mudam no disco. A thread do
+// FileWatcher invalida o cache do pr-processador e j expande as novas
+// fontes; a compilao e a troca dos programas ficam para update(), que a
+// thread da OpenGL chama entre um quadro e outro. S os caches de variantes
+// que dependem do arquivo alterado so recompilados. Com
+// GL_KHR_parallel_shader_compile o update() s dispara a compilao e os
+// programas so trocados em quadros seguintes, quando o link termina; sem a
+// extenso a compilao acontece no prprio update(), como antes.
+class ShaderHotReload
+{
+public:
+	ShaderHotReload(ShaderPreprocessor& preprocessor) : preprocessor(preprocessor) {}
+	~ShaderHotReload() { stop(); }
+
+	void add(ShaderVariantCache* cache);
+	void start();
+	void stop();
+
+	// Thread da OpenGL: comea as recargas que chegaram, troca os programas que j
+	// terminaram de compilar e retorna quantos foram trocados
+	int update();
+
+protected:
+	struct PendingReload
+	{
+		ShaderVariantCache* cache;
+		std::string vertexSource;
+		std::string fragmentSource;
+	};
+
+	void onFilesChanged(const std::vector<std::string>& files);
+	void watchDependencies(ShaderVariantCache* cache);
+
+	ShaderPreprocessor& preprocessor;
+	FileWatcher watcher;
+	std::vector<ShaderVariantCache*> caches;
+	std::mutex mutex;
+	std::vector<PendingReload> pending;
+};
@@ -0,0 +1,142 @@
+#include "ShaderPreprocessor.h"
+
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <algorithm>
+#include <filesystem>
+
+std::string ShaderPreprocessor::normalize(const std::string& path)
+{
+	return std::filesystem::path(path).lexically_normal().generic_string();
+}
+
+std::string ShaderPreprocessor::load(const std::string& path)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	std::string key = normalize(path);
+	auto it = cache.find(key);
+	if (it != cache.end())
+		return it->second.source;
+
+	Expanded expanded;
+	std::vector<std::string> stack;
+	expanded.dependencies.insert(key);
+	if (!expand(key, true, stack, expanded.dependencies, expanded.source))
+		std::cout << "ERROR::SHADER::PREPROCESSOR " << key << std::endl;
+
+	cache[key] = expanded;
+	return expanded.source;
+}
+
+std::set<std::string> ShaderPreprocessor::dependencies(const std::string& root)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	auto it = cache.find(normalize(root));
+	if (it == cache.end())
+		return std::set<std::string>();
+	return it->second.dependencies;
+}
+
+std::set<std::string> ShaderPreprocessor::invalidate(const std::string& file)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	std::string key = normalize(file);
+	std::set<std::string> roots;
+	for (auto it = cache.begin(); it != cache.end();)
+	{
+		if (it->second.dependencies.count(key))
+		{
+			roots.insert(it->first);
+			it = cache.erase(it);
+		}
+		else
+			++it;
+	}
+	return roots;
+}
+
+std::string ShaderPreprocessor::fileName(int id)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return (id >= 0 && id < (int)names.size()) ? names[id] : std::string();
+}
+
+int ShaderPreprocessor::fileId(const std::string& path)
+{
+	auto it = ids.find(path);
+	if (it != ids.end())
+		return it->second;
+	int id = (int)names.size();
+	names.push_back(path);
+	ids[path] = id;
+	return id;
+}
+
+bool ShaderPreprocessor::expand(const std::string& path, bool root, std::vector<std::string>& stack, std::set<std::string>& dependencies, std::string& out)
+{
+	std::ifstream file(path.c_str());
+	if (!file.is_open())
+	{
+		std::cout << "ERROR::SHADER::FILE_NOT_SUCCESFULLY_READ " << path << std::endl;
+		return false;
+	}
+
+	bool ok = true;
+	int id = fileId(path);
+	std::string directory = std::filesystem::path(path).parent_path().generic_string();
+	stack.push_back(path);
+
+	std::string line;
+	int lineNumber = 0;
+	while (std::getline(file, line))
+	{
+		lineNumber++;
+		size_t start = line.find_first_not_of(" \t");
+		std::string directive = (start == std::string::npos) ? "" : line.substr(start);
+
+		if (directive.compare(0, 8, "#include") == 0)
+		{
+			size_t open = directive.find_first_of("\"<", 8);
+			size_t close = (open == std::string::npos) ? open : directive.find_first_of("\">", open + 1);
+			if (close == std::string::npos)
+			{
+				std::cout << "ERROR::SHADER::PREPROCESSOR " << path << "(" << lineNumber << "): #include mal formado" << std::endl;
+				ok = false;
+				out += "\n";
+				continue;
+			}
+			std::string name = directive.substr(open + 1, close - open - 1);
+			std::string includePath = normalize(directory.empty() ? name : directory + "/" + name);
+
+			if (std::find(stack.begin(), stack.end(), includePath) != stack.end())
+			{
+				std::cout << "ERROR::SHADER::PREPROCESSOR " << path << "(" << lineNumber << "): include circular de " << includePath << std::endl;
+				ok = false;
+				out += "\n";
+				continue;
+			}
+			dependencies.insert(includePath);
+
+			// Cada incluso  expandida e quem descarta as repetidas  o prprio
+			// pr-processador do GLSL, pela guarda: assim um #include dentro de um
+			// #ifdef desligado no esconde o arquivo das outras incluses
+			int includeId = fileId(includePath);
+			std::string guard = "INCLUDE_GUARD_" + std::to_string(includeId);
+			out += "#ifndef " + guard + "\n#define " + guard + "\n";
+			out += "#line 1 " + std::to_string(includeId) + "\n";
+			ok = expand(includePath, false, stack, dependencies, out) && ok;
+			out += "#endif\n";
+			out += "#line " + std::to_string(lineNumber + 1) + " " + std::to_string(id) + "\n";
+			continue;
+		}
+
+		out += line + "\n";
+		// A diretiva #version tem que vir antes de tudo, ento a numerao do arquivo raiz comea depois dela
+		if (root && directive.compare(0, 8, "#version") == 0)
+			out += "#line " + std::to_string(lineNumber + 1) + " " + std::to_string(id) + "\n";
+	}
+
+	stack.pop_back();
+	return ok;
+}
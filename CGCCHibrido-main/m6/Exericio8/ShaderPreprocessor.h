@@ -0,0 +1,48 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <set>
+#include <map>
+#include <mutex>
+
+// Pr-processador de GLSL com suporte a #include "arquivo".
+// Os caminhos so relativos ao arquivo que inclui. Cada arquivo entra uma
+// vez s por programa (como #pragma once): a expanso fica entre um
+// #ifndef/#define/#endif com o nmero do arquivo, ento a repetio 
+// descartada pelo compilador do GLSL depois de avaliar os #ifdef. As fontes
+// expandidas ficam em cache junto com a lista de arquivos de que dependem,
+// para o hot reload saber quais programas recompilar quando um arquivo muda.
+//  seguro chamar de vrias threads.
+class ShaderPreprocessor
+{
+public:
+	// Retorna a fonte expandida (do cache, se ainda for vlida)
+	std::string load(const std::string& path);
+
+	// Todos os arquivos que a fonte expandida de 'root' usa (inclusive ele mesmo)
+	std::set<std::string> dependencies(const std::string& root);
+
+	// Descarta o cache de tudo que depende de 'file' e retorna esses arquivos raiz
+	std::set<std::string> invalidate(const std::string& file);
+
+	// Arquivo correspondente ao nmero de fonte usado nas diretivas #line
+	std::string fileName(int id);
+
+	static std::string normalize(const std::string& path);
+
+protected:
+	struct Expanded
+	{
+		std::string source;
+		std::set<std::string> dependencies;
+	};
+
+	bool expand(const std::string& path, bool root, std::vector<std::string>& stack, std::set<std::string>& dependencies, std::string& out);
+	int fileId(const std::string& path);
+
+	std::mutex mutex;
+	std::map<std::string, Expanded> cache;
+	std::map<std::string, int> ids;
+	std::vector<std::string> names;
+};
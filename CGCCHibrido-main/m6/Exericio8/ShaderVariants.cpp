@@ -0,0 +1,203 @@
+#include "ShaderVariants.h"
+
+#include "GLDevice.h"
+
+static const char* featureNames[SHADER_FEATURE_COUNT] = { "TEXTURED", "LIT", "VERTEX_COLOR", "INSTANCED", "OBJECT_BUFFER", "CLUSTERED", "GBUFFER", "SHADOWS" };
+
+ShaderVariantCache::ShaderVariantCache(ShaderPreprocessor& preprocessor, const std::string& vertexPath, const std::string& fragmentPath)
+	: preprocessor(preprocessor), vertexPath(vertexPath), fragmentPath(fragmentPath), rebuildSwapped(0)
+{
+	vertexSource = preprocessor.load(vertexPath);
+	fragmentSource = preprocessor.load(fragmentPath);
+}
+
+ShaderVariantCache::~ShaderVariantCache()
+{
+	clear();
+}
+
+void ShaderVariantCache::clear()
+{
+	cancelRebuild();
+	for (auto& variant : variants)
+	{
+		glState.deleteProgram(variant.second->ID);
+		delete variant.second;
+	}
+	variants.clear();
+}
+
+Shader* ShaderVariantCache::get(unsigned features)
+{
+	auto it = variants.find(features);
+	if (it != variants.end())
+		return it->second;
+	if (failed.count(features))
+		return nullptr;
+
+	Shader* shader = new Shader();
+	if (!shader->compile(injectDefines(vertexSource, features), injectDefines(fragmentSource, features)))
+	{
+		std::cout << "ERROR::SHADER::VARIANT " << vertexPath << " " << fragmentPath << "\n" << defineBlock(features) << std::endl;
+		glDeleteProgram(shader->ID);
+		delete shader;
+		failed.insert(features);
+		return nullptr;
+	}
+	bindUniformBlocks(shader->ID);
+	variants[features] = shader;
+	return shader;
+}
+
+static GLuint startShader(GLenum type, const std::string& source)
+{
+	const GLchar* code = source.c_str();
+	GLuint shader = glCreateShader(type);
+	glShaderSource(shader, 1, &code, NULL);
+	glCompileShader(shader);
+	return shader;
+}
+
+// Mesmas mensagens do Shader::compile
+static bool shaderCompiled(GLuint shader, const char* stage)
+{
+	GLint success;
+	GLchar infoLog[512];
+	glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+	if (!success)
+	{
+		glGetShaderInfoLog(shader, 512, NULL, infoLog);
+		std::cout << "ERROR::SHADER::" << stage << "::COMPILATION_FAILED\n" << infoLog << std::endl;
+	}
+	return success != 0;
+}
+
+void ShaderVariantCache::beginRebuild(const std::string& vertexSource, const std::string& fragmentSource)
+{
+	cancelRebuild();
+	this->vertexSource = vertexSource;
+	this->fragmentSource = fragmentSource;
+	// As fontes mudaram: as variantes que falharam voltam a ser tentadas no prximo get()
+	failed.clear();
+
+	// S dispara a compilao e o link; consultar o status aqui faria o driver esperar por eles
+	for (auto& variant : variants)
+	{
+		PendingVariant pending;
+		pending.features = variant.first;
+		pending.vertex = startShader(GL_VERTEX_SHADER, injectDefines(vertexSource, variant.first));
+		pending.fragment = startShader(GL_FRAGMENT_SHADER, injectDefines(fragmentSource, variant.first));
+		pending.program = glCreateProgram();
+		glAttachShader(pending.program, pending.vertex);
+		glAttachShader(pending.program, pending.fragment);
+		glLinkProgram(pending.program);
+		building.push_back(pending);
+	}
+}
+
+int ShaderVariantCache::finishRebuild()
+{
+	if (building.empty())
+		return 0;
+
+	int swapped = 0;
+	for (size_t i = 0; i < building.size();)
+	{
+		PendingVariant pending = building[i];
+		// Sem a extenso no h como perguntar: o status abaixo espera o link terminar
+		if (glDevice.parallelShaderCompile())
+		{
+			GLint completed = GL_FALSE;
+			glGetProgramiv(pending.program, GL_COMPLETION_STATUS_KHR, &completed);
+			if (!completed)
+			{
+				i++;
+				continue;
+			}
+		}
+		building.erase(building.begin() + i);
+
+		bool vertexCompiled = shaderCompiled(pending.vertex, "VERTEX");
+		bool fragmentCompiled = shaderCompiled(pending.fragment, "FRAGMENT");
+		bool compiled = vertexCompiled && fragmentCompiled;
+		GLint linked = GL_FALSE;
+		glGetProgramiv(pending.program, GL_LINK_STATUS, &linked);
+		if (compiled && !linked)
+		{
+			GLchar infoLog[512];
+			glGetProgramInfoLog(pending.program, 512, NULL, infoLog);
+			std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n" << infoLog << std::endl;
+		}
+		glDeleteShader(pending.vertex);
+		glDeleteShader(pending.fragment);
+
+		if (!compiled || !linked)
+		{
+			// Mantm o programa antigo funcionando at a fonte ser corrigida
+			std::cout << "ERROR::SHADER::RELOAD " << vertexPath << " " << fragmentPath << "\n" << defineBlock(pending.features) << std::endl;
+			glDeleteProgram(pending.program);
+			continue;
+		}
+		bindUniformBlocks(pending.program);
+		Shader* shader = variants[pending.features];
+		GLuint old = shader->ID;
+		shader->ID = pending.program;
+		glState.deleteProgram(old);
+		swapped++;
+	}
+
+	rebuildSwapped += swapped;
+	if (building.empty())
+	{
+		if (rebuildSwapped > 0)
+			std::cout << "Shader recarregado: " << vertexPath << " " << fragmentPath << " (" << rebuildSwapped << " variantes)" << std::endl;
+		rebuildSwapped = 0;
+	}
+	return swapped;
+}
+
+void ShaderVariantCache::cancelRebuild()
+{
+	for (PendingVariant& pending : building)
+	{
+		glDeleteShader(pending.vertex);
+		glDeleteShader(pending.fragment);
+		glDeleteProgram(pending.program);
+	}
+	building.clear();
+	rebuildSwapped = 0;
+}
+
+std::string ShaderVariantCache::defineBlock(unsigned features)
+{
+	std::string block;
+	for (int i = 0; i < SHADER_FEATURE_COUNT; i++)
+	{
+		if (features & (1u << i))
+			block += std::string("#define ") + featureNames[i] + "\n";
+	}
+	return block;
+}
+
+std::string ShaderVariantCache::injectDefines(const std::string& source, unsigned features)
+{
+	// O #version precisa continuar sendo a primeira diretiva do shader
+	size_t versionPos = source.find("#version");
+	size_t insertPos = 0;
+	if (versionPos != std::string::npos)
+	{
+		insertPos = source.find('\n', versionPos);
+		insertPos = (insertPos == std::string::npos) ? source.size() : insertPos + 1;
+		// Num contexto 3.3 os shaders #version 450 descem para 330 (o que eles usam existe nas duas)
+		if (glDevice.versionMajor() != 0 && !glDevice.atLeast(4, 5))
+			return source.substr(0, versionPos) + glDevice.glslVersion() + "\n" + defineBlock(features) + source.substr(insertPos);
+	}
+	return source.substr(0, insertPos) + defineBlock(features) + source.substr(insertPos);
+}
+
+void ShaderVariantCache::bindUniformBlocks(GLuint program)
+{
+	GLuint index = glGetUniformBlockIndex(program, "ObjectData");
+	if (index != GL_INVALID_INDEX)
+		glUniformBlockBinding(program, index, UNIFORM_BINDING_OBJECT);
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "Shader.h"
+#include "ShaderPreprocessor.h"
+
+// Features do uber-shader (shaders/uber.vs e uber.fs). Cada bit vira um
+// #define na compilao, ento uma variante s paga pelo que usa.
+enum ShaderFeature
+{
+	SHADER_TEXTURED = 1 << 0,
+	SHADER_LIT = 1 << 1,
+	SHADER_VERTEX_COLOR = 1 << 2,
+	SHADER_INSTANCED = 1 << 3,
+	SHADER_OBJECT_BUFFER = 1 << 4, //Matriz do objeto no bloco ObjectData em vez do uniform model
+	SHADER_CLUSTERED = 1 << 5, //Soma as luzes pontuais do ClusteredLighting (s com LIT)
+	SHADER_GBUFFER = 1 << 6, //Escreve no G-buffer do DeferredRenderer em vez de iluminar
+	SHADER_SHADOWS = 1 << 7, //Sombra da luz principal pelos mapas do CascadedShadows (s com LIT)
+	SHADER_FEATURE_COUNT = 8
+};
+
+// Pontos de ligao dos blocos de uniforms do uber-shader (glUniformBlockBinding
+//  feito na compilao de cada variante, j que o GLSL 330 no tem layout(binding))
+enum UniformBinding
+{
+	UNIFORM_BINDING_OBJECT = 0 //Bloco ObjectData
+};
+
+// Cache de variantes do uber-shader, indexado pela mscara de features.
+// As variantes so compiladas sob demanda na primeira vez que so pedidas.
+// As fontes passam pelo ShaderPreprocessor, ento podem usar #include.
+class ShaderVariantCache
+{
+public:
+	ShaderVariantCache(ShaderPreprocessor& preprocessor, const std::string& vertexPath, const std::string& fragmentPath);
+	~ShaderVariantCache();
+
+	// Retorna (compilando se preciso) a variante com exatamente essas features, ou nullptr
+	// se ela no compila. A variante com erro no entra no cache e s  tentada de novo
+	// depois da prxima mudana nas fontes (rebuild)
+	Shader* get(unsigned features);
+	int size() const { return (int)variants.size(); }
+	// Apaga todos os programas (chamar antes de destruir o contexto OpenGL)
+	void clear();
+
+	// Comea a recompilar todas as variantes j criadas com as novas fontes, sem
+	// esperar o resultado (com parallelShaderCompile o driver compila em outras
+	// threads). Uma recompilao anterior ainda em andamento  abandonada.
+	void beginRebuild(const std::string& vertexSource, const std::string& fragmentSource);
+	// Troca as variantes cuja recompilao j terminou; chamar a cada quadro. Cada uma
+	// s  trocada se compilar e linkar sem erro; os ponteiros Shader* continuam
+	// vlidos. Retorna quantos programas foram trocados.
+	int finishRebuild();
+	bool rebuilding() const { return !building.empty(); }
+
+	const std::string& vertexFile() const { return vertexPath; }
+	const std::string& fragmentFile() const { return fragmentPath; }
+
+	// Gera as linhas "#define X" correspondentes  mscara
+	static std::string defineBlock(unsigned features);
+	// Insere o bloco de defines logo aps a diretiva #version
+	static std::string injectDefines(const std::string& source, unsigned features);
+	// Liga os blocos de uniforms do programa aos pontos de UniformBinding
+	static void bindUniformBlocks(GLuint program);
+
+protected:
+	// Variante sendo recompilada: os objetos ficam vivos at o link terminar
+	struct PendingVariant
+	{
+		unsigned features;
+		GLuint vertex, fragment, program;
+	};
+
+	// Apaga os objetos da recompilao em andamento
+	void cancelRebuild();
+
+	ShaderPreprocessor& preprocessor;
+	std::string vertexPath;
+	std::string fragmentPath;
+	std::string vertexSource;
+	std::string fragmentSource;
+	std::unordered_map<unsigned, Shader*> variants;
+	std::unordered_set<unsigned> failed; //Variantes que no compilaram com as fontes atuais
+	std::vector<PendingVariant> building;
+	int rebuildSwapped; //Programas trocados na recompilao em andamento
+};
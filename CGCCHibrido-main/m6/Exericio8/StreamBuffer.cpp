@@ -0,0 +1,151 @@
+#include "StreamBuffer.h"
+
+#include <iostream>
+#include <chrono>
+#include <algorithm>
+
+#include "GLDevice.h"
+#include "GLState.h"
+#include "Profiler.h"
+
+void StreamBufferStats::add(const StreamBufferStats& other)
+{
+	bytes += other.bytes;
+	allocations += other.allocations;
+	fenceWaits += other.fenceWaits;
+	waitMs += other.waitMs;
+	overflows += other.overflows;
+}
+
+StreamBuffer::StreamBuffer() : name(0), frameSize(0), coherent(true), mapped(nullptr), frame(0), head(0), flushed(0),
+	uniformAlignment(256), storageAlignment(256), overflowReported(false)
+{
+	for (int i = 0; i < FRAME_COUNT; i++)
+		fences[i] = 0;
+}
+
+StreamBuffer::~StreamBuffer()
+{
+	release();
+}
+
+void StreamBuffer::init(GLsizeiptr frameSize, bool coherent)
+{
+	release();
+	this->coherent = coherent;
+	glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &uniformAlignment);
+	storageAlignment = uniformAlignment;
+	if (glDevice.atLeast(4, 3))
+		glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &storageAlignment);
+
+	// Cada regio comea alinhada para qualquer uso
+	GLsizeiptr alignment = std::max(uniformAlignment, storageAlignment);
+	this->frameSize = (frameSize + alignment - 1) / alignment * alignment;
+	GLsizeiptr totalSize = this->frameSize * FRAME_COUNT;
+
+	if (glDevice.bufferStorage())
+	{
+		GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | (coherent ? GL_MAP_COHERENT_BIT : 0);
+		// DYNAMIC_STORAGE s para o glBufferSubData servir de reserva se o mapeamento falhar
+		name = glDevice.createBuffer(totalSize, NULL, flags | GL_DYNAMIC_STORAGE_BIT);
+		mapped = (char*)glDevice.mapBuffer(name, 0, totalSize, flags | (coherent ? 0 : GL_MAP_FLUSH_EXPLICIT_BIT));
+		if (!mapped)
+			std::cout << "ERROR::STREAMBUFFER::MAP falhou, usando glBufferSubData" << std::endl;
+	}
+	else
+		name = glDevice.createBuffer(totalSize, NULL, GL_DYNAMIC_STORAGE_BIT);
+	if (!mapped)
+		shadow.resize(this->frameSize);
+	std::cout << "StreamBuffer: " << FRAME_COUNT << " x " << this->frameSize << " bytes, "
+		<< (mapped ? (coherent ? "mapeamento persistente coerente" : "mapeamento persistente com flush explicito") : "glBufferSubData") << std::endl;
+
+	frame = FRAME_COUNT - 1;
+	head = flushed = 0;
+}
+
+void StreamBuffer::release()
+{
+	for (int i = 0; i < FRAME_COUNT; i++)
+	{
+		if (fences[i])
+			glDeleteSync(fences[i]);
+		fences[i] = 0;
+	}
+	// Apagar o buffer desfaz o mapeamento persistente
+	if (name != 0)
+		glState.deleteBuffer(name);
+	name = 0;
+	mapped = nullptr;
+	shadow.clear();
+}
+
+void StreamBuffer::beginFrame()
+{
+	frame = (frame + 1) % FRAME_COUNT;
+	head = flushed = 0;
+
+	GLsync fence = fences[frame];
+	if (!fence)
+		return;
+	// Normalmente a GPU terminou esse quadro h tempo e a consulta volta na hora
+	GLenum result = glClientWaitSync(fence, 0, 0);
+	if (result == GL_TIMEOUT_EXPIRED)
+	{
+		PROFILE_ZONE("StreamBuffer::wait");
+		auto start = std::chrono::high_resolution_clock::now();
+		do
+			result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+		while (result == GL_TIMEOUT_EXPIRED);
+		current.fenceWaits++;
+		current.waitMs += std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+	}
+	glDeleteSync(fence);
+	fences[frame] = 0;
+}
+
+StreamAllocation StreamBuffer::allocate(GLsizeiptr size, GLsizeiptr alignment)
+{
+	StreamAllocation allocation;
+	GLsizeiptr offset = (head + alignment - 1) & ~(alignment - 1);
+	if (offset + size > frameSize)
+	{
+		current.overflows++;
+		if (!overflowReported)
+		{
+			std::cout << "StreamBuffer: alocacao de " << size << " bytes nao cabe na regiao de " << frameSize << " bytes do quadro" << std::endl;
+			overflowReported = true;
+		}
+		return allocation;
+	}
+	head = offset + size;
+
+	allocation.buffer = name;
+	allocation.offset = frame * frameSize + offset;
+	allocation.size = size;
+	allocation.data = mapped ? mapped + allocation.offset : shadow.data() + offset;
+	current.bytes += size;
+	current.allocations++;
+	return allocation;
+}
+
+void StreamBuffer::flush()
+{
+	if (head == flushed)
+		return;
+	GLintptr offset = frame * frameSize + flushed;
+	GLsizeiptr size = head - flushed;
+	if (!mapped)
+		glDevice.updateBuffer(name, offset, size, shadow.data() + flushed);
+	else if (!coherent)
+		glDevice.flushMappedBuffer(name, offset, size);
+	flushed = head;
+}
+
+void StreamBuffer::endFrame()
+{
+	flush();
+	fences[frame] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	lastFrame = current;
+	total.add(current);
+	current = StreamBufferStats();
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+//GLAD
+#include <glad/glad.h>
+
+#include <vector>
+
+// Contadores do StreamBuffer
+struct StreamBufferStats
+{
+	long long bytes = 0; //Bytes entregues nas alocaes
+	int allocations = 0;
+	int fenceWaits = 0; //Quadros em que a regio ainda estava com a GPU
+	double waitMs = 0.0; //Tempo parado nessas esperas
+	int overflows = 0; //Alocaes que no couberam na regio do quadro
+
+	void add(const StreamBufferStats& other);
+};
+
+// Um pedao do StreamBuffer: escrever em 'data' e usar (buffer, offset) no draw
+struct StreamAllocation
+{
+	GLuint buffer = 0;
+	GLintptr offset = 0;
+	GLsizeiptr size = 0;
+	void* data = nullptr; //nullptr se no coube
+};
+
+// Buffer circular para os dados que mudam todo quadro (matrizes dos objetos,
+// blocos de uniforms, SSBOs, dados de instncia).  um buffer s, dividido em
+// FRAME_COUNT regies: o quadro N escreve na regio N % 3 enquanto a GPU ainda
+// pode estar lendo as outras duas, e cada regio tem um glFenceSync que s 
+// esperado quando ela volta a ser a atual, trs quadros depois.
+//
+// Com glBufferStorage (4.4) o buffer fica mapeado o tempo todo (persistente) e
+// as alocaes so ponteiros direto nele: a CPU escreve onde a GPU vai ler,
+// sem cpia do driver. Coerente, a escrita j fica visvel; seno flush() faz
+// o glFlushMappedBufferRange do que foi escrito. Sem glBufferStorage as
+// alocaes vo para uma cpia na memria e flush() envia o trecho com
+// glBufferSubData, numa regio que a cerca garante que a GPU j largou.
+//
+// Uso por quadro: beginFrame(), allocate*() e escrita, flush() antes dos
+// draws que leem o que foi escrito, endFrame() depois do ltimo deles.
+class StreamBuffer
+{
+public:
+	static const int FRAME_COUNT = 3;
+
+	StreamBuffer();
+	~StreamBuffer();
+
+	// frameSize = bytes disponveis por quadro; coherent = GL_MAP_COHERENT_BIT em vez de flush explcito
+	void init(GLsizeiptr frameSize, bool coherent = true);
+	void release();
+
+	// Passa para a prxima regio, esperando a GPU terminar o quadro que a usou
+	void beginFrame();
+	// Pedao alinhado a 'alignment' (potncia de 2) na regio do quadro atual
+	StreamAllocation allocate(GLsizeiptr size, GLsizeiptr alignment);
+	// Alinhados para glBindBufferRange de UBO, de SSBO e para atributos de instncia
+	StreamAllocation allocateUniform(GLsizeiptr size) { return allocate(size, uniformAlignment); }
+	StreamAllocation allocateStorage(GLsizeiptr size) { return allocate(size, storageAlignment); }
+	StreamAllocation allocateVertices(GLsizeiptr size) { return allocate(size, 16); }
+	// Torna visvel para a GPU tudo o que foi alocado desde o ltimo flush
+	void flush();
+	// Coloca a cerca da regio atual (depois do ltimo draw que a usa)
+	void endFrame();
+
+	GLuint buffer() const { return name; }
+	bool persistent() const { return mapped != nullptr; }
+	GLsizeiptr frameCapacity() const { return frameSize; }
+	GLint uniformOffsetAlignment() const { return uniformAlignment; }
+
+	const StreamBufferStats& frameStats() const { return lastFrame; }
+	const StreamBufferStats& totalStats() const { return total; }
+
+protected:
+	GLuint name;
+	GLsizeiptr frameSize;
+	bool coherent;
+	// Incio do mapeamento persistente (nullptr no caminho sem glBufferStorage)
+	char* mapped;
+	// Cpia da regio atual no caminho sem glBufferStorage
+	std::vector<char> shadow;
+	GLsync fences[FRAME_COUNT];
+	int frame;
+	GLsizeiptr head; //Prximo byte livre da regio atual
+	GLsizeiptr flushed; //At onde a regio atual j foi enviada/flushed
+	GLint uniformAlignment, storageAlignment;
+	bool overflowReported;
+
+	StreamBufferStats current, lastFrame, total;
+};
@@ -0,0 +1,101 @@
+#include "SystemScheduler.h"
+
+#include <algorithm>
+#include <sstream>
+
+#include "JobSystem.h"
+#include "Profiler.h"
+
+void SystemScheduler::add(const char* name, ComponentMask reads, ComponentMask writes, const SystemFunc& run, bool usesJobs)
+{
+	System system = { name, reads, writes, run, usesJobs };
+	systems.push_back(system);
+	phasesDirty = true;
+}
+
+bool SystemScheduler::conflicts(const System& a, const System& b)
+{
+	return (a.writes & (b.reads | b.writes)) != 0 || (b.writes & a.reads) != 0;
+}
+
+void SystemScheduler::buildPhases()
+{
+	phases.clear();
+	std::vector<int> phaseOf(systems.size(), 0);
+	for (int i = 0; i < (int)systems.size(); i++)
+	{
+		int phase = 0;
+		for (int j = 0; j < i; j++)
+			if (conflicts(systems[i], systems[j]))
+				phase = std::max(phase, phaseOf[j] + 1);
+		phaseOf[i] = phase;
+		if (phase >= (int)phases.size())
+			phases.resize(phase + 1);
+		phases[phase].push_back(i);
+	}
+	phasesDirty = false;
+}
+
+void SystemScheduler::run()
+{
+	if (phasesDirty)
+		buildPhases();
+	std::vector<int> spread;
+	for (const std::vector<int>& phase : phases)
+	{
+		// Os que usam o jobSystem por dentro rodam nesta thread, um depois do outro; dentro
+		// do parallelFor da fase o parallelFor deles rodaria inteiro numa thread s
+		spread.clear();
+		for (int index : phase)
+		{
+			const System& system = systems[index];
+			if (!system.usesJobs)
+			{
+				spread.push_back(index);
+				continue;
+			}
+			PROFILE_ZONE(system.name);
+			system.run();
+		}
+		// Sozinho, o sistema roda nesta thread tambm (sem o custo de acordar as outras)
+		if (spread.size() == 1)
+		{
+			const System& system = systems[spread[0]];
+			PROFILE_ZONE(system.name);
+			system.run();
+			continue;
+		}
+		if (spread.empty())
+			continue;
+		jobSystem.parallelFor((int)spread.size(), 1, [&](int begin, int end) {
+			for (int i = begin; i < end; i++)
+			{
+				const System& system = systems[spread[i]];
+				PROFILE_ZONE(system.name);
+				system.run();
+			}
+		});
+	}
+}
+
+int SystemScheduler::phaseCount()
+{
+	if (phasesDirty)
+		buildPhases();
+	return (int)phases.size();
+}
+
+std::string SystemScheduler::describe()
+{
+	if (phasesDirty)
+		buildPhases();
+	std::ostringstream out;
+	for (int i = 0; i < (int)phases.size(); i++)
+	{
+		out << (i > 0 ? " -> " : "") << "[";
+		for (int j = 0; j < (int)phases[i].size(); j++)
+			out << (j > 0 ? ", " : "") << systems[phases[i][j]].name << (systems[phases[i][j]].usesJobs ? " (jobs)" : "");
+		out << "]";
+	}
+	return out.str();
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <functional>
+
+#include "ECS.h"
+
+// Ordem de execuo dos sistemas do quadro. Cada sistema declara os
+// componentes que l e os que escreve; dois sistemas conflitam se um escreve
+// o que o outro l ou escreve. Os sistemas so separados em fases na ordem em
+// que foram adicionados: um sistema vai para a fase seguinte  do ltimo
+// sistema anterior com que conflita, e os da mesma fase rodam em paralelo no
+// jobSystem. Quem conflita continua na ordem de add(). Um parallelFor dentro
+// de outro roda serializado, ento os sistemas que dividem o prprio trabalho
+// no jobSystem (usesJobs) no entram nessa diviso: rodam um de cada vez na
+// thread que chamou run(), com todas as threads disponveis para eles.
+class SystemScheduler
+{
+public:
+	typedef std::function<void()> SystemFunc;
+
+	SystemScheduler() : phasesDirty(false) {}
+
+	// usesJobs: o sistema chama jobSystem.parallelFor por dentro
+	void add(const char* name, ComponentMask reads, ComponentMask writes, const SystemFunc& run, bool usesJobs = false);
+	// Roda todas as fases, uma depois da outra
+	void run();
+
+	int phaseCount();
+	// Fases e sistemas de cada uma, para conferir o que ficou em paralelo
+	std::string describe();
+
+protected:
+	struct System
+	{
+		const char* name;
+		ComponentMask reads, writes;
+		SystemFunc run;
+		bool usesJobs;
+	};
+
+	static bool conflicts(const System& a, const System& b);
+	void buildPhases();
+
+	std::vector<System> systems;
+	std::vector<std::vector<int>> phases; //ndices em 'systems'
+	bool phasesDirty;
+};
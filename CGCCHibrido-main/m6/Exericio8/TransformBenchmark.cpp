@@ -0,0 +1,109 @@
+#include "TransformBenchmark.h"
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <algorithm>
+
+//GLM
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "TransformHierarchy.h"
+
+// Matriz de mundo pela definio: local do n vezes a do pai, subindo at a raiz
+static glm::mat4 referenceWorld(const TransformHierarchy& hierarchy, int node)
+{
+	glm::mat4 local = glm::translate(glm::mat4(1.0f), hierarchy.getPosition(node)) * glm::mat4_cast(hierarchy.getRotation(node))
+		* glm::scale(glm::mat4(1.0f), hierarchy.getScale(node));
+	int parent = hierarchy.getParent(node);
+	return parent == TRANSFORM_NONE ? local : referenceWorld(hierarchy, parent) * local;
+}
+
+void runTransformBenchmark(int nodes)
+{
+	const int ROOTS = 1000;
+	const int FRAMES = 100;
+
+	// Cada rvore cresce pendurando o n novo num dos ns recentes dela, o que
+	// d profundidades variadas; as rvores ficam intercaladas no vetor como
+	// numa cena carregada aos poucos
+	std::mt19937 random(1234);
+	std::uniform_real_distribution<float> offset(-2.0f, 2.0f);
+	std::uniform_real_distribution<float> angle(0.0f, 6.2831853f);
+	TransformHierarchy hierarchy;
+	hierarchy.reserve(nodes);
+	std::vector<std::vector<int>> trees(ROOTS);
+	std::vector<int> roots;
+	for (int r = 0; r < ROOTS && r < nodes; r++)
+	{
+		int root = hierarchy.create(TRANSFORM_NONE, glm::vec3(offset(random), 0.0f, offset(random)) * 50.0f);
+		roots.push_back(root);
+		trees[r].push_back(root);
+	}
+	while (hierarchy.size() < nodes)
+	{
+		std::vector<int>& tree = trees[random() % ROOTS];
+		int parent = tree[tree.size() - 1 - random() % std::min<size_t>(tree.size(), 3)];
+		glm::quat rotation = glm::angleAxis(angle(random), glm::normalize(glm::vec3(offset(random), offset(random), offset(random)) + glm::vec3(0.0f, 0.01f, 0.0f)));
+		tree.push_back(hierarchy.create(parent, glm::vec3(offset(random), offset(random), offset(random)), rotation, glm::vec3(0.9f)));
+	}
+	hierarchy.update();
+
+	std::cout << "Benchmark de transformacoes: " << hierarchy.size() << " nos em " << ROOTS << " arvores, SIMD " << TransformHierarchy::simdName() << std::endl;
+	std::cout << std::setw(26) << "caso" << std::setw(12) << "ms" << std::setw(14) << "recalculados" << std::endl;
+
+	struct Case
+	{
+		const char* name;
+		TransformHierarchy::Mode mode;
+		bool allRoots; //Todas as razes giram (tudo sujo) ou s 1% dos ns mexe
+	};
+	const Case cases[] = {
+		{ "tudo, escalar", TransformHierarchy::MODE_SCALAR, true },
+		{ "tudo, SIMD", TransformHierarchy::MODE_SIMD, true },
+		{ "1% dos nos, escalar", TransformHierarchy::MODE_SCALAR, false },
+		{ "1% dos nos, SIMD", TransformHierarchy::MODE_SIMD, false },
+		{ "nada mudou", TransformHierarchy::MODE_SIMD, false }
+	};
+	std::uniform_int_distribution<int> pick(0, hierarchy.size() - 1);
+	for (const Case& c : cases)
+	{
+		bool idle = &c == &cases[4];
+		double ms = 0.0;
+		long long recomputed = 0;
+		for (int frame = 0; frame < FRAMES; frame++)
+		{
+			if (c.allRoots)
+			{
+				for (int root : roots)
+					hierarchy.setRotation(root, glm::angleAxis(frame * 0.01f, glm::vec3(0.0f, 1.0f, 0.0f)));
+			}
+			else if (!idle)
+			{
+				for (int k = 0; k < hierarchy.size() / 100; k++)
+				{
+					int node = pick(random);
+					hierarchy.setPosition(node, hierarchy.getPosition(node) + glm::vec3(0.001f));
+				}
+			}
+			auto start = std::chrono::high_resolution_clock::now();
+			recomputed += hierarchy.update(c.mode);
+			ms += std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+		}
+		std::cout << std::setw(26) << c.name << std::fixed << std::setprecision(4) << std::setw(12) << ms / FRAMES << std::setw(14) << recomputed / FRAMES << std::endl;
+	}
+
+	// Confere uma amostra contra a conta recursiva
+	float maxError = 0.0f;
+	for (int k = 0; k < 1000; k++)
+	{
+		int node = pick(random);
+		glm::mat4 expected = referenceWorld(hierarchy, node);
+		for (int c = 0; c < 4; c++)
+			for (int r = 0; r < 4; r++)
+				maxError = std::max(maxError, std::abs(hierarchy.world(node)[c][r] - expected[c][r]) / std::max(1.0f, std::abs(expected[c][r])));
+	}
+	std::cout << "maior erro relativo contra a referencia: " << std::scientific << std::setprecision(2) << maxError << std::endl;
+}
@@ -0,0 +1,7 @@
+#pragma once
+
+// Benchmark da TransformHierarchy com 'nodes' ns em 1000 rvores (at uns 8
+// nveis de profundidade). Mede o update com todas as razes girando (tudo
+// recalculado) e com 1% dos ns mexendo, no caminho escalar e no SIMD, e confere
+// as matrizes contra a conta recursiva com glm. No usa a OpenGL.
+void runTransformBenchmark(int nodes = 100000);
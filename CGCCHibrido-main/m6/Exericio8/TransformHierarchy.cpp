@@ -0,0 +1,205 @@
+#include "TransformHierarchy.h"
+
+#include <algorithm>
+#include <initializer_list>
+
+#include "Profiler.h"
+
+// AVX quando o compilador gera AVX (/arch:AVX2 ou -mavx2)
+#if defined(__AVX__)
+#include <immintrin.h>
+#define CG_TRANSFORM_AVX 1
+#endif
+
+TransformHierarchy::TransformHierarchy() : nodes(0), firstDirty(0), updates(0)
+{
+}
+
+const char* TransformHierarchy::simdName()
+{
+#if defined(CG_TRANSFORM_AVX)
+	return "AVX";
+#else
+	return "escalar";
+#endif
+}
+
+void TransformHierarchy::reserve(int count)
+{
+	int padded = (count + 7) & ~7;
+	for (std::vector<float>* v : { &posX, &posY, &posZ, &rotX, &rotY, &rotZ, &rotW, &scaleX, &scaleY, &scaleZ })
+		v->reserve(padded);
+	parents.reserve(count);
+	dirty.reserve(count);
+	updatedIn.reserve(count);
+	worlds.reserve(count);
+}
+
+void TransformHierarchy::clear()
+{
+	for (std::vector<float>* v : { &posX, &posY, &posZ, &rotX, &rotY, &rotZ, &rotW, &scaleX, &scaleY, &scaleZ })
+		v->clear();
+	parents.clear();
+	dirty.clear();
+	updatedIn.clear();
+	worlds.clear();
+	nodes = 0;
+	firstDirty = 0;
+}
+
+int TransformHierarchy::create(int parent, const glm::vec3& position, const glm::quat& rotation, const glm::vec3& scale)
+{
+	int node = nodes++;
+	// Cresce de 8 em 8; as sobras so identidades que nunca so usadas
+	int padded = (nodes + 7) & ~7;
+	if ((int)posX.size() < padded)
+	{
+		for (std::vector<float>* v : { &posX, &posY, &posZ, &rotX, &rotY, &rotZ, &scaleX, &scaleY, &scaleZ })
+			v->resize(padded, 0.0f);
+		rotW.resize(padded, 1.0f);
+	}
+	parents.push_back(parent);
+	dirty.push_back(1);
+	updatedIn.push_back(0);
+	worlds.push_back(glm::mat4(1.0f));
+	setLocal(node, position, rotation, scale);
+	return node;
+}
+
+void TransformHierarchy::markDirty(int node)
+{
+	dirty[node] = 1;
+	if (node < firstDirty)
+		firstDirty = node;
+}
+
+void TransformHierarchy::setPosition(int node, const glm::vec3& position)
+{
+	posX[node] = position.x;
+	posY[node] = position.y;
+	posZ[node] = position.z;
+	markDirty(node);
+}
+
+void TransformHierarchy::setRotation(int node, const glm::quat& rotation)
+{
+	rotX[node] = rotation.x;
+	rotY[node] = rotation.y;
+	rotZ[node] = rotation.z;
+	rotW[node] = rotation.w;
+	markDirty(node);
+}
+
+void TransformHierarchy::setScale(int node, const glm::vec3& scale)
+{
+	scaleX[node] = scale.x;
+	scaleY[node] = scale.y;
+	scaleZ[node] = scale.z;
+	markDirty(node);
+}
+
+void TransformHierarchy::setLocal(int node, const glm::vec3& position, const glm::quat& rotation, const glm::vec3& scale)
+{
+	setPosition(node, position);
+	setRotation(node, rotation);
+	setScale(node, scale);
+}
+
+int TransformHierarchy::update(Mode mode)
+{
+	PROFILE_ZONE("TransformHierarchy::update");
+	// 0 fica para "nunca recalculado"
+	if (++updates == 0)
+		updates = 1;
+
+	int recomputed = 0;
+	glm::mat4 locals[8];
+	for (int begin = firstDirty & ~7; begin < nodes; begin += 8)
+	{
+		// Quem do bloco precisa ser recalculado. Um pai no mesmo bloco vem antes do
+		// filho, ento a marca dele j est feita quando o filho  olhado.
+		int end = std::min(begin + 8, nodes);
+		int mask = 0;
+		for (int i = begin; i < end; i++)
+		{
+			int parent = parents[i];
+			if (dirty[i] || (parent != TRANSFORM_NONE && updatedIn[parent] == updates))
+			{
+				updatedIn[i] = updates;
+				mask |= 1 << (i - begin);
+			}
+		}
+		if (mask == 0)
+			continue;
+
+		if (mode == MODE_SIMD)
+			computeLocalsSimd(begin, locals);
+		else
+			computeLocalsScalar(begin, locals);
+
+		for (int i = begin; i < end; i++)
+		{
+			if (!(mask & (1 << (i - begin))))
+				continue;
+			int parent = parents[i];
+			worlds[i] = parent == TRANSFORM_NONE ? locals[i - begin] : worlds[parent] * locals[i - begin];
+			dirty[i] = 0;
+			recomputed++;
+		}
+	}
+	firstDirty = nodes;
+	return recomputed;
+}
+
+void TransformHierarchy::computeLocalsScalar(int begin, glm::mat4* locals) const
+{
+	for (int k = 0; k < 8; k++)
+	{
+		int i = begin + k;
+		float x = rotX[i], y = rotY[i], z = rotZ[i], w = rotW[i];
+		// Colunas da rotao do quaternion (a mesma conta do glm::mat4_cast), j multiplicadas pela escala
+		glm::mat4& m = locals[k];
+		m[0] = glm::vec4(1.0f - 2.0f * (y * y + z * z), 2.0f * (x * y + w * z), 2.0f * (x * z - w * y), 0.0f) * scaleX[i];
+		m[1] = glm::vec4(2.0f * (x * y - w * z), 1.0f - 2.0f * (x * x + z * z), 2.0f * (y * z + w * x), 0.0f) * scaleY[i];
+		m[2] = glm::vec4(2.0f * (x * z + w * y), 2.0f * (y * z - w * x), 1.0f - 2.0f * (x * x + y * y), 0.0f) * scaleZ[i];
+		m[3] = glm::vec4(posX[i], posY[i], posZ[i], 1.0f);
+	}
+}
+
+void TransformHierarchy::computeLocalsSimd(int begin, glm::mat4* locals) const
+{
+#if defined(CG_TRANSFORM_AVX)
+	// Mesma conta do escalar, com cada registrador levando um componente de 8 ns
+	__m256 x = _mm256_loadu_ps(&rotX[begin]), y = _mm256_loadu_ps(&rotY[begin]), z = _mm256_loadu_ps(&rotZ[begin]), w = _mm256_loadu_ps(&rotW[begin]);
+	__m256 sx = _mm256_loadu_ps(&scaleX[begin]), sy = _mm256_loadu_ps(&scaleY[begin]), sz = _mm256_loadu_ps(&scaleZ[begin]);
+	const __m256 one = _mm256_set1_ps(1.0f), two = _mm256_set1_ps(2.0f);
+
+	__m256 xx = _mm256_mul_ps(x, x), yy = _mm256_mul_ps(y, y), zz = _mm256_mul_ps(z, z);
+	__m256 xy = _mm256_mul_ps(x, y), xz = _mm256_mul_ps(x, z), yz = _mm256_mul_ps(y, z);
+	__m256 wx = _mm256_mul_ps(w, x), wy = _mm256_mul_ps(w, y), wz = _mm256_mul_ps(w, z);
+
+	// Linhas de 'rows' = os 9 elementos 3x3 (coluna por coluna) de 8 ns
+	alignas(32) float rows[9][8];
+	_mm256_store_ps(rows[0], _mm256_mul_ps(_mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(yy, zz))), sx));
+	_mm256_store_ps(rows[1], _mm256_mul_ps(_mm256_mul_ps(two, _mm256_add_ps(xy, wz)), sx));
+	_mm256_store_ps(rows[2], _mm256_mul_ps(_mm256_mul_ps(two, _mm256_sub_ps(xz, wy)), sx));
+	_mm256_store_ps(rows[3], _mm256_mul_ps(_mm256_mul_ps(two, _mm256_sub_ps(xy, wz)), sy));
+	_mm256_store_ps(rows[4], _mm256_mul_ps(_mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(xx, zz))), sy));
+	_mm256_store_ps(rows[5], _mm256_mul_ps(_mm256_mul_ps(two, _mm256_add_ps(yz, wx)), sy));
+	_mm256_store_ps(rows[6], _mm256_mul_ps(_mm256_mul_ps(two, _mm256_add_ps(xz, wy)), sz));
+	_mm256_store_ps(rows[7], _mm256_mul_ps(_mm256_mul_ps(two, _mm256_sub_ps(yz, wx)), sz));
+	_mm256_store_ps(rows[8], _mm256_mul_ps(_mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(xx, yy))), sz));
+
+	// De volta para uma matriz por n
+	for (int k = 0; k < 8; k++)
+	{
+		glm::mat4& m = locals[k];
+		m[0] = glm::vec4(rows[0][k], rows[1][k], rows[2][k], 0.0f);
+		m[1] = glm::vec4(rows[3][k], rows[4][k], rows[5][k], 0.0f);
+		m[2] = glm::vec4(rows[6][k], rows[7][k], rows[8][k], 0.0f);
+		m[3] = glm::vec4(posX[begin + k], posY[begin + k], posZ[begin + k], 1.0f);
+	}
+#else
+	computeLocalsScalar(begin, locals);
+#endif
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+//GLM
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#define TRANSFORM_NONE (-1)
+
+// Hierarquia de transformaes da cena (grafo de cena s com as matrizes).
+// Os dados locais (posio, rotao em quaternion e escala) ficam em SoA, um
+// vetor por componente, e os ns so ndices criados sempre depois do pai, ento
+// o vetor j est na ordem pais-antes-dos-filhos. update() passa uma vez pelo
+// vetor a partir do primeiro n sujo: um n  recalculado se o local dele mudou
+// ou se o pai foi recalculado nessa mesma passada, o que cobre as subrvores
+// inteiras sem recurso nem pilha. As matrizes locais saem de 8 em 8 com AVX.
+class TransformHierarchy
+{
+public:
+	enum Mode
+	{
+		MODE_SCALAR, //Um n por vez (referncia para comparar)
+		MODE_SIMD //Matrizes locais de 8 ns por vez com AVX (escalar sem AVX)
+	};
+
+	TransformHierarchy();
+
+	// Cria um n filho de 'parent' (TRANSFORM_NONE = raiz) e devolve o ndice dele
+	int create(int parent = TRANSFORM_NONE, const glm::vec3& position = glm::vec3(0.0f), const glm::quat& rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f),
+		const glm::vec3& scale = glm::vec3(1.0f));
+	void reserve(int count);
+	void clear();
+	int size() const { return nodes; }
+	int getParent(int node) const { return parents[node]; }
+
+	void setPosition(int node, const glm::vec3& position);
+	void setRotation(int node, const glm::quat& rotation);
+	void setScale(int node, const glm::vec3& scale);
+	void setLocal(int node, const glm::vec3& position, const glm::quat& rotation, const glm::vec3& scale);
+	glm::vec3 getPosition(int node) const { return glm::vec3(posX[node], posY[node], posZ[node]); }
+	glm::quat getRotation(int node) const { return glm::quat(rotW[node], rotX[node], rotY[node], rotZ[node]); }
+	glm::vec3 getScale(int node) const { return glm::vec3(scaleX[node], scaleY[node], scaleZ[node]); }
+
+	// Recalcula as matrizes de mundo dos ns sujos e dos descendentes deles. Retorna quantos foram recalculados.
+	int update(Mode mode = MODE_SIMD);
+	// Matriz de mundo calculada no ltimo update()
+	const glm::mat4& world(int node) const { return worlds[node]; }
+
+	// Nome do caminho SIMD compilado ("AVX" ou "escalar")
+	static const char* simdName();
+
+protected:
+	void markDirty(int node);
+	// Matrizes locais (T * R * S) dos ns [begin, begin + 8)
+	void computeLocalsScalar(int begin, glm::mat4* locals) const;
+	void computeLocalsSimd(int begin, glm::mat4* locals) const;
+
+	// Local em SoA, com folga at o mltiplo de 8
+	std::vector<float> posX, posY, posZ;
+	std::vector<float> rotX, rotY, rotZ, rotW;
+	std::vector<float> scaleX, scaleY, scaleZ;
+	std::vector<int> parents;
+	std::vector<uint8_t> dirty;
+	// Nmero do update em que o n foi recalculado pela ltima vez
+	std::vector<unsigned> updatedIn;
+	std::vector<glm::mat4> worlds;
+	int nodes;
+	int firstDirty;
+	unsigned updates;
+};
@@ -0,0 +1,36 @@
+#version 450 core
+// Passo de luz do deferred: reconstroi cada pixel do G-buffer (posicao a partir
+// da profundidade) e ilumina com a mesma conta do forward, inclusive as luzes em
+// clusters na variante CLUSTERED
+uniform sampler2D gAlbedo;
+uniform sampler2D gNormal;
+uniform sampler2D gDepth;
+uniform mat4 inverseViewProjection;
+// Viewport (x, y, largura, altura): com a resolucao dinamica so um canto do G-buffer e usado
+uniform vec4 viewport;
+
+out vec4 color;
+
+#include "include/octahedral.glsl"
+#include "include/phong.glsl"
+
+void main()
+{
+    ivec2 pixel = ivec2(gl_FragCoord.xy);
+    float depth = texelFetch(gDepth, pixel, 0).r;
+    // Fundo: fica a cor com que a tela foi limpa
+    if (depth == 1.0)
+        discard;
+    vec4 albedo = texelFetch(gAlbedo, pixel, 0);
+    if (albedo.a == 0.0)
+    {
+        color = vec4(albedo.rgb, 1.0);
+        return;
+    }
+
+    vec2 uv = (vec2(pixel) - viewport.xy + 0.5) / viewport.zw;
+    vec4 world = inverseViewProjection * vec4(vec3(uv, depth) * 2.0 - 1.0, 1.0);
+    vec3 fragPos = world.xyz / world.w;
+    vec3 normal = decodeOctahedral(texelFetch(gNormal, pixel, 0).xy);
+    color = vec4(albedo.rgb * phongLighting(fragPos, normal, albedo.a * 256.0), 1.0);
+}
@@ -0,0 +1,7 @@
+#version 450 core
+// Triangulo que cobre a tela inteira, sem buffer de vertices (os cantos saem de gl_VertexID)
+void main()
+{
+    vec2 corner = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+    gl_Position = vec4(corner * 2.0 - 1.0, 0.0, 1.0);
+}
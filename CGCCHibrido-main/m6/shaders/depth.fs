@@ -0,0 +1,5 @@
+#version 450 core
+// Pre-passo de profundidade: sem saida de cor, so o teste e a escrita da profundidade
+void main()
+{
+}
@@ -0,0 +1,24 @@
+#version 450 core
+// Pre-passo de profundidade: so a posicao (fluxo de vertices so com posicoes)
+// e a mesma conta de gl_Position do uber.vs. Os dois marcam gl_Position como
+// invariant para o passo principal poder testar com GL_EQUAL.
+layout (location = 0) in vec3 position;
+#ifdef OBJECT_BUFFER
+layout (std140) uniform ObjectData
+{
+    mat4 model;
+};
+#else
+uniform mat4 model;
+#endif
+
+uniform mat4 view;
+uniform mat4 projection;
+
+invariant gl_Position;
+
+void main()
+{
+    vec4 worldPos = model * vec4(position, 1.0);
+    gl_Position = projection * view * worldPos;
+}
@@ -0,0 +1,36 @@
+// Luzes pontuais em clusters (ClusteredLighting): o fragmento acha o seu cluster
+// pela posicao na tela e pela profundidade e so percorre as luzes dele
+uniform samplerBuffer clusterLights;   // 2 texels por luz: posicao e raio, cor
+uniform usamplerBuffer clusterGrid;    // (inicio, quantidade) de cada cluster
+uniform usamplerBuffer clusterIndices; // luzes de todos os clusters, em sequencia
+uniform vec4 clusterScreen;            // ladrilho em pixels (x, y), GRID_X, GRID_Y
+uniform vec4 clusterDepth;             // near, far, GRID_Z / log(far / near), GRID_Z
+#include "view.glsl"
+
+vec3 clusteredLighting(vec3 fragPos, vec3 norm, vec3 viewDir, float shininess)
+{
+    // Mesmas fatias logaritmicas de ClusteredLighting::depthSlice
+    float depth = -(view * vec4(fragPos, 1.0)).z;
+    float slice = clamp(floor(log(max(depth, clusterDepth.x) / clusterDepth.x) * clusterDepth.z), 0.0, clusterDepth.w - 1.0);
+    vec2 tile = min(floor(gl_FragCoord.xy / clusterScreen.xy), clusterScreen.zw - 1.0);
+    int cluster = int((slice * clusterScreen.w + tile.y) * clusterScreen.z + tile.x);
+    uvec2 range = texelFetch(clusterGrid, cluster).xy;
+
+    vec3 result = vec3(0.0);
+    for (uint i = 0u; i < range.y; i++)
+    {
+        int light = int(texelFetch(clusterIndices, int(range.x + i)).r);
+        vec4 positionRadius = texelFetch(clusterLights, light * 2);
+        vec3 toLight = positionRadius.xyz - fragPos;
+        float distance = length(toLight);
+        if (distance >= positionRadius.w)
+            continue;
+        vec3 lightDir = toLight / distance;
+        // Some suavemente ate zero no raio, que e o limite usado na distribuicao
+        float falloff = 1.0 - distance / positionRadius.w;
+        float diff = max(dot(norm, lightDir), 0.0);
+        float spec = pow(max(dot(viewDir, reflect(-lightDir, norm)), 0.0), shininess);
+        result += (diff + spec) * falloff * falloff * texelFetch(clusterLights, light * 2 + 1).rgb;
+    }
+    return result;
+}
@@ -0,0 +1,40 @@
+// Iluminacao de Phong com uma luz pontual (usada por todos os programas iluminados)
+// e, na variante CLUSTERED, mais as luzes do cluster do fragmento. Na variante
+// SHADOWS a luz principal e direcional (a mesma direcao das cascatas, que o
+// CascadedShadows manda em lightDirection) e passa pelos mapas de sombra.
+uniform vec3 lightPos;
+uniform vec3 viewPos;
+uniform vec3 lightColor;
+#ifdef CLUSTERED
+#include "clustered.glsl"
+#endif
+#ifdef SHADOWS
+#include "shadows.glsl"
+#endif
+
+vec3 phongLighting(vec3 fragPos, vec3 normal, float shininess)
+{
+    vec3 ambient = 0.1 * lightColor;
+    vec3 norm = normalize(normal);
+#ifdef SHADOWS
+    vec3 lightDir = normalize(-lightDirection);
+#else
+    vec3 lightDir = normalize(lightPos - fragPos);
+#endif
+    float diff = max(dot(norm, lightDir), 0.0);
+    vec3 diffuse = diff * lightColor;
+    vec3 viewDir = normalize(viewPos - fragPos);
+    vec3 reflectDir = reflect(-lightDir, norm);
+    float spec = pow(max(dot(viewDir, reflectDir), 0.0), shininess);
+    vec3 specular = spec * lightColor;
+#ifdef SHADOWS
+    float lit = shadowFactor(fragPos, norm);
+#else
+    float lit = 1.0;
+#endif
+#ifdef CLUSTERED
+    return ambient + lit * (diffuse + specular) + clusteredLighting(fragPos, norm, viewDir, shininess);
+#else
+    return ambient + lit * (diffuse + specular);
+#endif
+}
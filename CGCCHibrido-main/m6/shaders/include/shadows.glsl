@@ -0,0 +1,29 @@
+// Sombra da luz principal em cascatas (CascadedShadows): a cascata sai da
+// profundidade do fragmento e o mapa e filtrado com PCF de 3x3 amostras, cada
+// uma ja comparada e interpolada pelo hardware (sampler2DArrayShadow)
+#include "view.glsl"
+
+uniform sampler2DArrayShadow shadowMap;
+uniform vec3 lightDirection;    // direcao em que a luz viaja (a das cascatas)
+uniform mat4 shadowMatrices[3]; // mundo -> (u, v, profundidade) de cada cascata
+uniform vec4 shadowSplits;      // fim de cada cascata (profundidade na camera), w = distancia de desvio pela normal em texels
+uniform vec4 shadowTexels;      // tamanho do texel no mundo em cada cascata, w = 1 / resolucao
+
+float shadowFactor(vec3 fragPos, vec3 norm)
+{
+    float depth = -(view * vec4(fragPos, 1.0)).z;
+    if (depth >= shadowSplits.z)
+        return 1.0;
+    int cascade = depth < shadowSplits.x ? 0 : (depth < shadowSplits.y ? 1 : 2);
+    // Desloca o ponto pela normal (em texels da cascata) para evitar acne
+    vec3 offsetPos = fragPos + norm * shadowTexels[cascade] * shadowSplits.w;
+    vec4 coord = shadowMatrices[cascade] * vec4(offsetPos, 1.0);
+    if (coord.z >= 1.0)
+        return 1.0;
+
+    float lit = 0.0;
+    for (int y = -1; y <= 1; y++)
+        for (int x = -1; x <= 1; x++)
+            lit += texture(shadowMap, vec4(coord.xy + vec2(x, y) * shadowTexels.w, float(cascade), coord.z));
+    return lit / 9.0;
+}
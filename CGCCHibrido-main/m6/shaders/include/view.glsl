@@ -0,0 +1,2 @@
+// Camera do quadro, compartilhada pelos includes que precisam da profundidade do fragmento
+uniform mat4 view;
@@ -0,0 +1,5 @@
+#version 450 core
+// So a profundidade importa; nada e escrito em cor
+void main()
+{
+}
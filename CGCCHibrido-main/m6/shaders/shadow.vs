@@ -0,0 +1,11 @@
+#version 450 core
+// Profundidade vista da luz, para os mapas de sombra (CascadedShadows)
+layout (location = 0) in vec3 position;
+
+uniform mat4 model;
+uniform mat4 lightViewProjection;
+
+void main()
+{
+    gl_Position = lightViewProjection * model * vec4(position, 1.0);
+}
@@ -0,0 +1,62 @@
+#version 450 core
+// Uber-shader de fragmentos: cada feature desligada some do programa compilado
+#ifdef LIT
+in vec3 FragPos;
+in vec3 Normal;
+#endif
+#ifdef VERTEX_COLOR
+in vec3 vertexColor;
+#endif
+#ifdef INSTANCED
+flat in vec3 instanceColor;
+#endif
+#ifdef TEXTURED
+in vec2 texCoord;
+uniform sampler2D tex_buffer;
+#endif
+
+#ifdef GBUFFER
+// Passo de geometria do deferred: a luz fica para o passo de tela cheia (deferred.fs)
+layout (location = 0) out vec4 gAlbedo; // cor base e shininess / 256 (0 = sem luz)
+layout (location = 1) out vec2 gNormal; // normal de mundo em octaedro
+#include "include/octahedral.glsl"
+#else
+out vec4 color;
+#endif
+
+uniform vec3 diffuseColor;
+uniform float opacity;
+#ifdef LIT
+uniform float shininess;
+#ifndef GBUFFER
+#include "include/phong.glsl"
+#endif
+#endif
+
+void main()
+{
+    vec4 baseColor = vec4(diffuseColor, opacity);
+#ifdef INSTANCED
+    baseColor.rgb *= instanceColor;
+#endif
+#ifdef VERTEX_COLOR
+    baseColor.rgb *= vertexColor;
+#endif
+#ifdef TEXTURED
+    baseColor *= texture(tex_buffer, texCoord);
+#endif
+#ifdef GBUFFER
+#ifdef LIT
+    gAlbedo = vec4(baseColor.rgb, clamp(shininess / 256.0, 1.0 / 255.0, 1.0));
+    gNormal = encodeOctahedral(normalize(Normal));
+#else
+    gAlbedo = vec4(baseColor.rgb, 0.0);
+    gNormal = vec2(0.0);
+#endif
+#else
+#ifdef LIT
+    baseColor.rgb *= phongLighting(FragPos, Normal, shininess);
+#endif
+    color = baseColor;
+#endif
+}
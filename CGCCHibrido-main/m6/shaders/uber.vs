@@ -0,0 +1,67 @@
+#version 450 core
+// Uber-shader de vertices: as features sao ligadas por #define injetado
+// pelo ShaderVariantCache (TEXTURED, LIT, VERTEX_COLOR, INSTANCED, OBJECT_BUFFER)
+layout (location = 0) in vec3 position;
+#ifdef VERTEX_COLOR
+layout (location = 1) in vec3 color;
+#endif
+#ifdef TEXTURED
+layout (location = 2) in vec2 tex_coord;
+#endif
+#ifdef LIT
+layout (location = 3) in vec3 normal;
+#endif
+#ifdef INSTANCED
+layout (location = 4) in mat4 instanceModel;
+layout (location = 8) in uint instanceMaterial;
+// Paleta do InstancedRenderer (MAX_MATERIALS), indexada por instancia
+uniform vec3 materialColors[64];
+flat out vec3 instanceColor;
+#elif defined(OBJECT_BUFFER)
+// Matriz do objeto num pedaco do StreamBuffer, ligado com glBindBufferRange a cada desenho
+layout (std140) uniform ObjectData
+{
+    mat4 model;
+};
+#else
+uniform mat4 model;
+#endif
+
+uniform mat4 view;
+uniform mat4 projection;
+
+// Igual ao depth.vs, para o passo depois do pre-passo de profundidade (GL_EQUAL)
+invariant gl_Position;
+
+#ifdef LIT
+out vec3 FragPos;
+out vec3 Normal;
+#endif
+#ifdef VERTEX_COLOR
+out vec3 vertexColor;
+#endif
+#ifdef TEXTURED
+out vec2 texCoord;
+#endif
+
+void main()
+{
+#ifdef INSTANCED
+    mat4 M = instanceModel;
+    instanceColor = materialColors[instanceMaterial];
+#else
+    mat4 M = model;
+#endif
+    vec4 worldPos = M * vec4(position, 1.0);
+    gl_Position = projection * view * worldPos;
+#ifdef LIT
+    FragPos = worldPos.xyz;
+    Normal = mat3(transpose(inverse(M))) * normal;
+#endif
+#ifdef VERTEX_COLOR
+    vertexColor = color;
+#endif
+#ifdef TEXTURED
+    texCoord = vec2(tex_coord.x, 1.0 - tex_coord.y);
+#endif
+}